@@ -0,0 +1,12 @@
+int g(int a[4], int b[4]) {
+    a[0] = 10;
+    b[0] = b[0] + 1;
+    return a[0];
+}
+int main() {
+    int x[4];
+    int r;
+    x[0] = 1;
+    CALL r = g(x, x);
+    return r * 100 + x[0];
+}
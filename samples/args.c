@@ -0,0 +1,22 @@
+struct pt { int x; int y; };
+int many(int a, int b, int c, int d, int e, int f, int g, int h) {
+    int r;
+    r = a - b + c * d - e + f * g - h;
+    return r;
+}
+int seven(pt p, int b, int c, int d, int e, int f, int g) {
+    int r;
+    r = p.x * 1000 + g;
+    p.y = r;
+    return r;
+}
+int main() {
+    int r;
+    int s;
+    pt q;
+    q.x = 9;
+    CALL r = many(1, 2, 3, 4, 5, 6, 7, 8);
+    CALL s = seven(q, 2, 3, 4, 5, 6, 77);
+    r = r + s + q.y;
+    return r;
+}
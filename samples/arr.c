@@ -0,0 +1,26 @@
+struct pt { int x; int y; };
+int setp(pt p, int v) {
+    p.y = v;
+    return v;
+}
+int main() {
+    int a[10];
+    pt q;
+    int s;
+    int k;
+    int r;
+    k = 0;
+    while (k < 10) {
+        a[k] = k * k;
+        k++;
+    }
+    s = 0;
+    k = 0;
+    while (k < 10) {
+        s = s + a[k];
+        k++;
+    }
+    CALL r = setp(q, s);
+    s = q.y + r;
+    return s;
+}
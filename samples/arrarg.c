@@ -0,0 +1,23 @@
+int sum(int a[5], int n) {
+    int s;
+    int i;
+    s = 0;
+    i = 0;
+    while (i < n) {
+        s = s + a[i];
+        i = i + 1;
+    }
+    return s;
+}
+int main() {
+    int arr[5];
+    int t;
+    int i;
+    i = 0;
+    while (i < 5) {
+        arr[i] = i * 3;
+        i = i + 1;
+    }
+    CALL t = sum(arr, 5);
+    return t;
+}
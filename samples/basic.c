@@ -0,0 +1,20 @@
+int add(int x, int y) {
+    int r;
+    r = x + y;
+    return r;
+}
+int main() {
+    int a;
+    int b;
+    int c;
+    a = 1;
+    b = a * 2 + 3;
+    while (a < 10) {
+        a += 1;
+    }
+    if (b == 5) {
+        c = b;
+    }
+    CALL c = add(a, b);
+    return 0;
+}
@@ -0,0 +1,5105 @@
+int f0(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 1;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f1(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 2;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f2(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 3;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f3(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 4;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f4(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 5;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f5(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 6;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f6(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 7;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f7(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 8;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f8(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 9;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f9(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 10;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f10(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 11;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f11(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 12;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f12(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 13;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f13(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 14;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f14(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 15;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f15(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 16;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f16(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 17;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f17(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 18;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f18(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 19;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f19(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 20;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f20(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 21;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f21(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 22;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f22(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 23;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f23(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 24;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f24(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 25;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f25(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 26;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f26(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 27;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f27(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 28;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f28(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 29;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f29(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 30;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f30(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 31;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f31(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 32;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f32(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 33;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f33(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 34;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f34(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 35;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f35(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 36;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f36(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 37;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f37(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 38;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f38(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 39;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f39(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 40;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f40(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 41;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f41(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 42;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f42(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 43;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f43(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 44;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f44(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 45;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f45(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 46;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f46(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 47;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f47(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 48;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f48(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 49;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f49(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 50;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f50(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 51;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f51(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 52;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f52(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 53;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f53(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 54;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f54(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 55;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f55(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 56;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f56(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 57;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f57(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 58;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f58(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 59;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f59(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 60;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f60(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 61;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f61(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 62;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f62(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 63;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f63(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 64;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f64(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 65;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f65(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 66;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f66(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 67;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f67(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 68;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f68(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 69;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f69(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 70;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f70(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 71;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f71(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 72;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f72(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 73;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f73(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 74;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f74(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 75;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f75(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 76;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f76(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 77;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f77(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 78;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f78(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 79;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f79(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 80;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f80(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 81;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f81(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 82;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f82(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 83;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f83(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 84;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f84(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 85;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f85(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 86;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f86(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 87;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f87(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 88;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f88(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 89;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f89(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 90;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f90(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 91;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f91(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 92;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f92(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 93;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f93(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 94;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f94(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 95;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f95(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 96;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f96(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 97;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f97(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 98;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f98(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 99;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f99(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 100;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f100(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 101;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f101(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 102;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f102(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 103;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f103(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 104;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f104(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 105;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f105(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 106;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f106(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 107;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f107(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 108;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f108(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 109;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f109(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 110;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f110(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 111;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f111(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 112;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f112(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 113;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f113(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 114;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f114(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 115;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f115(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 116;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f116(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 117;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f117(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 118;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f118(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 119;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f119(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 120;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f120(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 121;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f121(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 122;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f122(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 123;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f123(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 124;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f124(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 125;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f125(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 126;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f126(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 127;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f127(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 128;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f128(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 129;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f129(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 130;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f130(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 131;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f131(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 132;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f132(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 133;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f133(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 134;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f134(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 135;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f135(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 136;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f136(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 137;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f137(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 138;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f138(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 139;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f139(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 140;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f140(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 141;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f141(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 142;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f142(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 143;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f143(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 144;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f144(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 145;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f145(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 146;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f146(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 147;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f147(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 148;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f148(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 149;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f149(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 150;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f150(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 151;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f151(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 152;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f152(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 153;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f153(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 154;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f154(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 155;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f155(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 156;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f156(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 157;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f157(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 158;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f158(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 159;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f159(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 160;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f160(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 161;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f161(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 162;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f162(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 163;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f163(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 164;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f164(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 165;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f165(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 166;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f166(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 167;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f167(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 168;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f168(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 169;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f169(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 170;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f170(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 171;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f171(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 172;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f172(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 173;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f173(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 174;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f174(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 175;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f175(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 176;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f176(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 177;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f177(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 178;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f178(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 179;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f179(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 180;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f180(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 181;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f181(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 182;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f182(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 183;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f183(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 184;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f184(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 185;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f185(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 186;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f186(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 187;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f187(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 188;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f188(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 189;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f189(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 190;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f190(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 191;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f191(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 192;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f192(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 193;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f193(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 194;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f194(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 195;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f195(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 196;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f196(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 197;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f197(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 198;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f198(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 199;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f199(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 200;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f200(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 201;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f201(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 202;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f202(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 203;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f203(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 204;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f204(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 205;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f205(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 206;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f206(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 207;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f207(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 208;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f208(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 209;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f209(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 210;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f210(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 211;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f211(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 212;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f212(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 213;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f213(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 214;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f214(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 215;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f215(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 216;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f216(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 217;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f217(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 218;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f218(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 219;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f219(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 220;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f220(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 221;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f221(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 222;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f222(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 223;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f223(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 224;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f224(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 225;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f225(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 226;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f226(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 227;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f227(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 228;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f228(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 229;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f229(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 230;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f230(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 231;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f231(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 232;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f232(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 233;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f233(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 234;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f234(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 235;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f235(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 236;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f236(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 237;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f237(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 238;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f238(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 239;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f239(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 240;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f240(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 241;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f241(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 242;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f242(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 243;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f243(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 244;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f244(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 245;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f245(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 246;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f246(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 247;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f247(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 248;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f248(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 249;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f249(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 250;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f250(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 251;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f251(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 252;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f252(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 253;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f253(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 254;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f254(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 255;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f255(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 256;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f256(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 257;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f257(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 258;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f258(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 259;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f259(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 260;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f260(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 261;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f261(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 262;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f262(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 263;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f263(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 264;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f264(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 265;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f265(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 266;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f266(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 267;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f267(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 268;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f268(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 269;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f269(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 270;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f270(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 271;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f271(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 272;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f272(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 273;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f273(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 274;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f274(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 275;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f275(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 276;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f276(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 277;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f277(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 278;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f278(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 279;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f279(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 280;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f280(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 281;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f281(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 282;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f282(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 283;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f283(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 284;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f284(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 285;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f285(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 286;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f286(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 287;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f287(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 288;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f288(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 289;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f289(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 290;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f290(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 291;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f291(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 292;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f292(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 293;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f293(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 294;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f294(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 295;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f295(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 296;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f296(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 297;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f297(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 298;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f298(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 299;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int f299(int a, int b) {
+    int i;
+    int s;
+    i = 0;
+    s = a;
+    while (i < b) {
+        s = s + i * 300;
+        if (s > 100) {
+            s = s - 7;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
+int main() {
+    int r;
+    r = 0;
+    CALL r = f0(r, 1);
+    CALL r = f1(r, 2);
+    CALL r = f2(r, 3);
+    CALL r = f3(r, 4);
+    CALL r = f4(r, 5);
+    CALL r = f5(r, 1);
+    CALL r = f6(r, 2);
+    CALL r = f7(r, 3);
+    CALL r = f8(r, 4);
+    CALL r = f9(r, 5);
+    CALL r = f10(r, 1);
+    CALL r = f11(r, 2);
+    CALL r = f12(r, 3);
+    CALL r = f13(r, 4);
+    CALL r = f14(r, 5);
+    CALL r = f15(r, 1);
+    CALL r = f16(r, 2);
+    CALL r = f17(r, 3);
+    CALL r = f18(r, 4);
+    CALL r = f19(r, 5);
+    CALL r = f20(r, 1);
+    CALL r = f21(r, 2);
+    CALL r = f22(r, 3);
+    CALL r = f23(r, 4);
+    CALL r = f24(r, 5);
+    CALL r = f25(r, 1);
+    CALL r = f26(r, 2);
+    CALL r = f27(r, 3);
+    CALL r = f28(r, 4);
+    CALL r = f29(r, 5);
+    CALL r = f30(r, 1);
+    CALL r = f31(r, 2);
+    CALL r = f32(r, 3);
+    CALL r = f33(r, 4);
+    CALL r = f34(r, 5);
+    CALL r = f35(r, 1);
+    CALL r = f36(r, 2);
+    CALL r = f37(r, 3);
+    CALL r = f38(r, 4);
+    CALL r = f39(r, 5);
+    CALL r = f40(r, 1);
+    CALL r = f41(r, 2);
+    CALL r = f42(r, 3);
+    CALL r = f43(r, 4);
+    CALL r = f44(r, 5);
+    CALL r = f45(r, 1);
+    CALL r = f46(r, 2);
+    CALL r = f47(r, 3);
+    CALL r = f48(r, 4);
+    CALL r = f49(r, 5);
+    CALL r = f50(r, 1);
+    CALL r = f51(r, 2);
+    CALL r = f52(r, 3);
+    CALL r = f53(r, 4);
+    CALL r = f54(r, 5);
+    CALL r = f55(r, 1);
+    CALL r = f56(r, 2);
+    CALL r = f57(r, 3);
+    CALL r = f58(r, 4);
+    CALL r = f59(r, 5);
+    CALL r = f60(r, 1);
+    CALL r = f61(r, 2);
+    CALL r = f62(r, 3);
+    CALL r = f63(r, 4);
+    CALL r = f64(r, 5);
+    CALL r = f65(r, 1);
+    CALL r = f66(r, 2);
+    CALL r = f67(r, 3);
+    CALL r = f68(r, 4);
+    CALL r = f69(r, 5);
+    CALL r = f70(r, 1);
+    CALL r = f71(r, 2);
+    CALL r = f72(r, 3);
+    CALL r = f73(r, 4);
+    CALL r = f74(r, 5);
+    CALL r = f75(r, 1);
+    CALL r = f76(r, 2);
+    CALL r = f77(r, 3);
+    CALL r = f78(r, 4);
+    CALL r = f79(r, 5);
+    CALL r = f80(r, 1);
+    CALL r = f81(r, 2);
+    CALL r = f82(r, 3);
+    CALL r = f83(r, 4);
+    CALL r = f84(r, 5);
+    CALL r = f85(r, 1);
+    CALL r = f86(r, 2);
+    CALL r = f87(r, 3);
+    CALL r = f88(r, 4);
+    CALL r = f89(r, 5);
+    CALL r = f90(r, 1);
+    CALL r = f91(r, 2);
+    CALL r = f92(r, 3);
+    CALL r = f93(r, 4);
+    CALL r = f94(r, 5);
+    CALL r = f95(r, 1);
+    CALL r = f96(r, 2);
+    CALL r = f97(r, 3);
+    CALL r = f98(r, 4);
+    CALL r = f99(r, 5);
+    CALL r = f100(r, 1);
+    CALL r = f101(r, 2);
+    CALL r = f102(r, 3);
+    CALL r = f103(r, 4);
+    CALL r = f104(r, 5);
+    CALL r = f105(r, 1);
+    CALL r = f106(r, 2);
+    CALL r = f107(r, 3);
+    CALL r = f108(r, 4);
+    CALL r = f109(r, 5);
+    CALL r = f110(r, 1);
+    CALL r = f111(r, 2);
+    CALL r = f112(r, 3);
+    CALL r = f113(r, 4);
+    CALL r = f114(r, 5);
+    CALL r = f115(r, 1);
+    CALL r = f116(r, 2);
+    CALL r = f117(r, 3);
+    CALL r = f118(r, 4);
+    CALL r = f119(r, 5);
+    CALL r = f120(r, 1);
+    CALL r = f121(r, 2);
+    CALL r = f122(r, 3);
+    CALL r = f123(r, 4);
+    CALL r = f124(r, 5);
+    CALL r = f125(r, 1);
+    CALL r = f126(r, 2);
+    CALL r = f127(r, 3);
+    CALL r = f128(r, 4);
+    CALL r = f129(r, 5);
+    CALL r = f130(r, 1);
+    CALL r = f131(r, 2);
+    CALL r = f132(r, 3);
+    CALL r = f133(r, 4);
+    CALL r = f134(r, 5);
+    CALL r = f135(r, 1);
+    CALL r = f136(r, 2);
+    CALL r = f137(r, 3);
+    CALL r = f138(r, 4);
+    CALL r = f139(r, 5);
+    CALL r = f140(r, 1);
+    CALL r = f141(r, 2);
+    CALL r = f142(r, 3);
+    CALL r = f143(r, 4);
+    CALL r = f144(r, 5);
+    CALL r = f145(r, 1);
+    CALL r = f146(r, 2);
+    CALL r = f147(r, 3);
+    CALL r = f148(r, 4);
+    CALL r = f149(r, 5);
+    CALL r = f150(r, 1);
+    CALL r = f151(r, 2);
+    CALL r = f152(r, 3);
+    CALL r = f153(r, 4);
+    CALL r = f154(r, 5);
+    CALL r = f155(r, 1);
+    CALL r = f156(r, 2);
+    CALL r = f157(r, 3);
+    CALL r = f158(r, 4);
+    CALL r = f159(r, 5);
+    CALL r = f160(r, 1);
+    CALL r = f161(r, 2);
+    CALL r = f162(r, 3);
+    CALL r = f163(r, 4);
+    CALL r = f164(r, 5);
+    CALL r = f165(r, 1);
+    CALL r = f166(r, 2);
+    CALL r = f167(r, 3);
+    CALL r = f168(r, 4);
+    CALL r = f169(r, 5);
+    CALL r = f170(r, 1);
+    CALL r = f171(r, 2);
+    CALL r = f172(r, 3);
+    CALL r = f173(r, 4);
+    CALL r = f174(r, 5);
+    CALL r = f175(r, 1);
+    CALL r = f176(r, 2);
+    CALL r = f177(r, 3);
+    CALL r = f178(r, 4);
+    CALL r = f179(r, 5);
+    CALL r = f180(r, 1);
+    CALL r = f181(r, 2);
+    CALL r = f182(r, 3);
+    CALL r = f183(r, 4);
+    CALL r = f184(r, 5);
+    CALL r = f185(r, 1);
+    CALL r = f186(r, 2);
+    CALL r = f187(r, 3);
+    CALL r = f188(r, 4);
+    CALL r = f189(r, 5);
+    CALL r = f190(r, 1);
+    CALL r = f191(r, 2);
+    CALL r = f192(r, 3);
+    CALL r = f193(r, 4);
+    CALL r = f194(r, 5);
+    CALL r = f195(r, 1);
+    CALL r = f196(r, 2);
+    CALL r = f197(r, 3);
+    CALL r = f198(r, 4);
+    CALL r = f199(r, 5);
+    CALL r = f200(r, 1);
+    CALL r = f201(r, 2);
+    CALL r = f202(r, 3);
+    CALL r = f203(r, 4);
+    CALL r = f204(r, 5);
+    CALL r = f205(r, 1);
+    CALL r = f206(r, 2);
+    CALL r = f207(r, 3);
+    CALL r = f208(r, 4);
+    CALL r = f209(r, 5);
+    CALL r = f210(r, 1);
+    CALL r = f211(r, 2);
+    CALL r = f212(r, 3);
+    CALL r = f213(r, 4);
+    CALL r = f214(r, 5);
+    CALL r = f215(r, 1);
+    CALL r = f216(r, 2);
+    CALL r = f217(r, 3);
+    CALL r = f218(r, 4);
+    CALL r = f219(r, 5);
+    CALL r = f220(r, 1);
+    CALL r = f221(r, 2);
+    CALL r = f222(r, 3);
+    CALL r = f223(r, 4);
+    CALL r = f224(r, 5);
+    CALL r = f225(r, 1);
+    CALL r = f226(r, 2);
+    CALL r = f227(r, 3);
+    CALL r = f228(r, 4);
+    CALL r = f229(r, 5);
+    CALL r = f230(r, 1);
+    CALL r = f231(r, 2);
+    CALL r = f232(r, 3);
+    CALL r = f233(r, 4);
+    CALL r = f234(r, 5);
+    CALL r = f235(r, 1);
+    CALL r = f236(r, 2);
+    CALL r = f237(r, 3);
+    CALL r = f238(r, 4);
+    CALL r = f239(r, 5);
+    CALL r = f240(r, 1);
+    CALL r = f241(r, 2);
+    CALL r = f242(r, 3);
+    CALL r = f243(r, 4);
+    CALL r = f244(r, 5);
+    CALL r = f245(r, 1);
+    CALL r = f246(r, 2);
+    CALL r = f247(r, 3);
+    CALL r = f248(r, 4);
+    CALL r = f249(r, 5);
+    CALL r = f250(r, 1);
+    CALL r = f251(r, 2);
+    CALL r = f252(r, 3);
+    CALL r = f253(r, 4);
+    CALL r = f254(r, 5);
+    CALL r = f255(r, 1);
+    CALL r = f256(r, 2);
+    CALL r = f257(r, 3);
+    CALL r = f258(r, 4);
+    CALL r = f259(r, 5);
+    CALL r = f260(r, 1);
+    CALL r = f261(r, 2);
+    CALL r = f262(r, 3);
+    CALL r = f263(r, 4);
+    CALL r = f264(r, 5);
+    CALL r = f265(r, 1);
+    CALL r = f266(r, 2);
+    CALL r = f267(r, 3);
+    CALL r = f268(r, 4);
+    CALL r = f269(r, 5);
+    CALL r = f270(r, 1);
+    CALL r = f271(r, 2);
+    CALL r = f272(r, 3);
+    CALL r = f273(r, 4);
+    CALL r = f274(r, 5);
+    CALL r = f275(r, 1);
+    CALL r = f276(r, 2);
+    CALL r = f277(r, 3);
+    CALL r = f278(r, 4);
+    CALL r = f279(r, 5);
+    CALL r = f280(r, 1);
+    CALL r = f281(r, 2);
+    CALL r = f282(r, 3);
+    CALL r = f283(r, 4);
+    CALL r = f284(r, 5);
+    CALL r = f285(r, 1);
+    CALL r = f286(r, 2);
+    CALL r = f287(r, 3);
+    CALL r = f288(r, 4);
+    CALL r = f289(r, 5);
+    CALL r = f290(r, 1);
+    CALL r = f291(r, 2);
+    CALL r = f292(r, 3);
+    CALL r = f293(r, 4);
+    CALL r = f294(r, 5);
+    CALL r = f295(r, 1);
+    CALL r = f296(r, 2);
+    CALL r = f297(r, 3);
+    CALL r = f298(r, 4);
+    CALL r = f299(r, 5);
+    return r;
+}
@@ -0,0 +1,27 @@
+int f(int a, int b) {
+    int q;
+    q = a / b;
+    q = q - 3000000000;
+    return q;
+}
+int main() {
+    int x;
+    int y;
+    int r;
+    int i;
+    x = 3000000000;
+    y = 7;
+    i = 0;
+    r = 0;
+    while (i < 5) {
+        CALL r = f(x, y);
+        x = x * 2 + r;
+        if (x > 100000000000) {
+            x = x / 3;
+        } elif (x == 5) {
+            x = 1;
+        }
+        i++;
+    }
+    return x;
+}
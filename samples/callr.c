@@ -0,0 +1,17 @@
+int f(int x) {
+    int r;
+    r = x + 1;
+    return r;
+}
+int h(int y) {
+    int t;
+    int d;
+    CALL t = f(y);
+    d = y / t;
+    return y;
+}
+int main() {
+    int r;
+    CALL r = h(3);
+    return r;
+}
@@ -0,0 +1,43 @@
+int sq(int x) {
+    return x * x;
+}
+int max2(int a, int b) {
+    if (a > b) {
+        return a;
+    } else {
+        return b;
+    }
+}
+int clamp(int v, int lo, int hi) {
+    int r;
+    CALL r = max2(v, lo);
+    if (r > hi) {
+        r = hi;
+    }
+    return r;
+}
+int mix(int a, int b) {
+    int t;
+    CALL t = sq(a);
+    t = t + b * 3;
+    return t;
+}
+int main() {
+    int i;
+    int s;
+    int t;
+    int u;
+    s = 0;
+    i = 0;
+    while (i < 300000) {
+        CALL t = sq(i);
+        CALL u = clamp(t, 100, 50000);
+        s = s + u;
+        CALL t = mix(i, s);
+        CALL u = max2(t, i);
+        s = s + u;
+        s = s - t;
+        i++;
+    }
+    return s;
+}
@@ -0,0 +1,29 @@
+int h(int q) {
+    int r;
+    r = q + 1;
+    return r;
+}
+int main() {
+    int a;
+    int b;
+    int c;
+    int i;
+    int d;
+    a = 3;
+    b = a;
+    i = 0;
+    c = 0;
+    while (i < 5) {
+        c = c + b;
+        d = b;
+        b = i;
+        a = b + d;
+        i = i + 1;
+    }
+    CALL c = h(c);
+    b = c;
+    CALL a = h(b);
+    d = b;
+    c += d;
+    return a + b + c + d;
+}
@@ -0,0 +1,23 @@
+int h(int a, int b) {
+    int x;
+    int y;
+    int z;
+    int i;
+    x = a;
+    y = x;
+    a = b;
+    z = y + a;
+    i = 0;
+    while (i < 5) {
+        x = y;
+        y = z;
+        z = x + y;
+        i = i + 1;
+    }
+    return z;
+}
+int main() {
+    int r;
+    CALL r = h(4, 9);
+    return r;
+}
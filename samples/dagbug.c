@@ -0,0 +1,8 @@
+int main() {
+    int r;
+    r = 0;
+    if (5 > 2) {
+        r = 1;
+    }
+    return r;
+}
@@ -0,0 +1,51 @@
+int f(int x) {
+    int a;
+    int b;
+    int c;
+    a = x * 3;
+    b = a + 7;
+    c = b * 2;
+    if (x > 5) {
+        b = x + 1;
+        return b;
+        c = c + 100;
+    }
+    else {
+        a = 2;
+        return a + x;
+    }
+    c = 9;
+    return c;
+}
+int g(int n) {
+    int s;
+    int i;
+    int t;
+    s = 0;
+    i = 0;
+    while (1) {
+        t = i * 5;
+        if (i >= n) {
+            break;
+            s = s + 1000;
+        }
+        s = s + i;
+        i = i + 1;
+        continue;
+        s = 0;
+    }
+    return s;
+}
+int main() {
+    int r;
+    int u;
+    int v;
+    u = 4;
+    u = 5;
+    CALL r = f(u);
+    CALL v = f(9);
+    r = r + v;
+    CALL v = g(10);
+    r = r + v;
+    return r;
+}
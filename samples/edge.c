@@ -0,0 +1,37 @@
+int acc(int n) {
+    int s;
+    int i;
+    while (i < n) {
+        s = s + i;
+        i++;
+    }
+    return s;
+}
+int dec(int n) {
+    n = n - 1;
+    return n;
+}
+int pick(int a, int b) {
+    if (a > b) {
+        return a - b;
+    }
+    return b;
+}
+int main() {
+    int x;
+    int y;
+    int z;
+    int k;
+    x = 5;
+    z = 0;
+    k = 0;
+    while (k < 4) {
+        CALL y = acc(x);
+        z = z + y;
+        CALL x = dec(x);
+        CALL y = pick(x, k);
+        z = z * 3 + y;
+        k++;
+    }
+    return z;
+}
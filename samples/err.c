@@ -0,0 +1,14 @@
+int rec(int n) {
+    int r;
+    int m;
+    m = n + 1;
+    CALL r = rec(m);
+    return r;
+}
+int main() {
+    int r;
+    int z;
+    z = 0;
+    CALL r = rec(z);
+    return r;
+}
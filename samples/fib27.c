@@ -0,0 +1,20 @@
+int fib(int n) {
+    int a;
+    int b;
+    int m;
+    if (n < 2) {
+        return n;
+    }
+    m = n - 1;
+    CALL a = fib(m);
+    m = n - 2;
+    CALL b = fib(m);
+    return a + b;
+}
+int main() {
+    int r;
+    int n;
+    n = 27;
+    CALL r = fib(n);
+    return r;
+}
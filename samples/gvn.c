@@ -0,0 +1,38 @@
+int f(int a, int b) {
+    int x;
+    int y;
+    int z;
+    int w;
+    x = a * b;
+    z = 0;
+    if (a > b) {
+        y = b * a + 1;
+        z = y - x;
+    }
+    elif (a * b > 10) {
+        y = a * b - 2;
+        z = y + a * b;
+    }
+    else {
+        z = b * a;
+    }
+    w = a - b;
+    while (z < 100) {
+        y = a - b;
+        z = z + y * y + w * w + 3;
+    }
+    return z + a * b;
+}
+int main() {
+    int r;
+    int s;
+    int i;
+    r = 0;
+    i = 0;
+    while (i < 20) {
+        CALL s = f(i, 7);
+        r = r + s;
+        i = i + 1;
+    }
+    return r;
+}
@@ -0,0 +1,66 @@
+struct pt { int x; int y; };
+int scale(int n, int m) {
+    int i;
+    int s;
+    int z;
+    s = 0;
+    i = 0;
+    z = 0;
+    while (i < n) {
+        i++;
+        if (i == 3) {
+            continue;
+        }
+        s = s + n * m + i;
+        if (s > 100000) {
+            break;
+        }
+        z = m / 4;
+    }
+    while (z > 100) {
+        s = s / z;
+    }
+    return s + z;
+}
+int main() {
+    pt q;
+    int a[20];
+    int i;
+    int j;
+    int s;
+    int w;
+    int d;
+    q.x = 3;
+    q.y = 5;
+    a[2] = 11;
+    s = 0;
+    i = 0;
+    d = 0;
+    while (i < 10) {
+        w = q.x * q.y;
+        a[i] = w + i;
+        if (i == 4) {
+            q.x = q.x + 1;
+        }
+        j = 0;
+        while (j < 5) {
+            s = s + a[2] * q.y + j;
+            j++;
+            if (j == 3) {
+                a[2] = a[2] + 1;
+            }
+        }
+        i++;
+    }
+    while (d > 0) {
+        s = s / d;
+        s = s + a[d];
+    }
+    i = 0;
+    while (a[2] < i) {
+        s = s + 1000;
+    }
+    CALL w = scale(7, 9);
+    s = s + w;
+    return s;
+}
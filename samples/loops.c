@@ -0,0 +1,20 @@
+int main() {
+    int i;
+    int s;
+    int t;
+    i = 0;
+    s = 0;
+    while (i < 10) {
+        t = i * 2;
+        s = s + t;
+        if (s > 20) {
+            s = s - 5;
+        } elif (s == 7) {
+            s += 3;
+        } else {
+            s = s + 1;
+        }
+        i++;
+    }
+    return s;
+}
@@ -0,0 +1,46 @@
+int main() {
+    int a[25600];
+    int b[25600];
+    int c[25600];
+    int n;
+    int i;
+    int j;
+    int k;
+    int t;
+    int s;
+    int u;
+    int v;
+    int sum;
+    n = 160;
+    i = 0;
+    while (i < 25600) {
+        a[i] = i - 7;
+        b[i] = 3 - i;
+        i++;
+    }
+    i = 0;
+    while (i < n) {
+        j = 0;
+        while (j < n) {
+            s = 0;
+            k = 0;
+            while (k < n) {
+                u = i * n + k;
+                v = k * n + j;
+                s = s + a[u] * b[v];
+                k++;
+            }
+            t = i * n + j;
+            c[t] = s;
+            j++;
+        }
+        i++;
+    }
+    sum = 0;
+    i = 0;
+    while (i < 25600) {
+        sum = sum + c[i];
+        i++;
+    }
+    return sum;
+}
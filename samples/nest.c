@@ -0,0 +1,22 @@
+int main() {
+    int i;
+    int j;
+    int s;
+    i = 0;
+    s = 0;
+    while (i < 10) {
+        j = 0;
+        while (j < i) {
+            if (j > 3) {
+                if (s > 5) {
+                    s = s - 1;
+                }
+            } else {
+                s = s + j;
+            }
+            j++;
+        }
+        i++;
+    }
+    return s;
+}
@@ -0,0 +1,11 @@
+int main() {
+    int a[5];
+    int z;
+    int k;
+    int r;
+    z = 0;
+    k = 5;
+    a[k] = 7;
+    r = a[k] / z;
+    return r;
+}
@@ -0,0 +1,75 @@
+int f(int x) {
+    int mode;
+    int r;
+    mode = 2;
+    r = 0;
+    if (mode == 1) {
+        r = x + 1;
+    } elif (mode == 2) {
+        r = x * 2;
+    } elif (mode == 3) {
+        r = x * 3;
+    } else {
+        r = 0 - x;
+    }
+    return r;
+}
+int g(int x) {
+    int k;
+    int r;
+    k = 0;
+    r = x;
+    if (k > 0) {
+        r = 100;
+    } elif (x > 5) {
+        r = x - 5;
+    } else {
+        r = x + 5;
+    }
+    if (k < 1) {
+        r = r + 1;
+    }
+    return r;
+}
+int main() {
+    int i;
+    int n;
+    int s;
+    int c;
+    int d;
+    int t;
+    n = 10;
+    c = 3;
+    d = c * 4 + 1;
+    s = 0;
+    i = 0;
+    while (i < n) {
+        if (d > 12) {
+            s = s + c;
+        } else {
+            s = s - 1000;
+        }
+        t = d;
+        if (c == 3) {
+            t = 13;
+        }
+        s = s + t;
+        i++;
+    }
+    while (c > 5) {
+        s = s + 1;
+    }
+    while (1) {
+        s = s + 1;
+        if (s > 200) {
+            break;
+        }
+    }
+    CALL t = f(s);
+    s = s + t;
+    CALL t = g(s);
+    s = s + t;
+    CALL t = g(2);
+    s = s + t;
+    return s;
+}
@@ -0,0 +1,32 @@
+int main() {
+    int p[5000];
+    int i;
+    int j;
+    int n;
+    int count;
+    int r;
+    n = 5000;
+    r = 0;
+    while (r < 20) {
+        count = 0;
+        i = 0;
+        while (i < n) {
+            p[i] = 1;
+            i++;
+        }
+        i = 2;
+        while (i < n) {
+            if (p[i] == 1) {
+                count++;
+                j = i * 2;
+                while (j < n) {
+                    p[j] = 0;
+                    j += i;
+                }
+            }
+            i++;
+        }
+        r++;
+    }
+    return count;
+}
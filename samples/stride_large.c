@@ -0,0 +1,31 @@
+int main() {
+    int a[40000];
+    int n;
+    int i;
+    int j;
+    int r;
+    int s;
+    int k;
+    n = 200;
+    i = 0;
+    while (i < 40000) {
+        a[i] = i - 300;
+        i++;
+    }
+    s = 0;
+    r = 0;
+    while (r < 300) {
+        j = 0;
+        while (j < n) {
+            i = 0;
+            while (i < n) {
+                k = i * n + j;
+                s = s + a[k] * 3;
+                i++;
+            }
+            j++;
+        }
+        r++;
+    }
+    return s;
+}
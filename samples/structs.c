@@ -0,0 +1,19 @@
+struct pt { int x; int y; };
+int sum(pt p) {
+    int r;
+    r = p.x + p.y;
+    return r;
+}
+int main() {
+    pt q;
+    int a[10];
+    int k;
+    int r;
+    q.x = 3;
+    q.y = 4;
+    k = 2;
+    a[k] = q.x;
+    a[3] = a[k] + 1;
+    CALL r = sum(q);
+    return r;
+}
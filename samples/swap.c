@@ -0,0 +1,16 @@
+int main() {
+    int w;
+    int x;
+    int y;
+    int i;
+    x = 1;
+    y = 2;
+    i = 0;
+    while (i < 20) {
+        w = x;
+        x = y;
+        y = w + y;
+        i = i + 1;
+    }
+    return y;
+}
@@ -0,0 +1,12 @@
+int main() {
+    int arr[4];
+    int i;
+    int r;
+    r = 12;
+    i = 0;
+    while (i < 4) {
+        arr[i] = r / (2 - i);
+        i = i + 1;
+    }
+    return arr[0];
+}
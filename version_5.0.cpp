@@ -7,6 +7,26 @@
 #include <sstream>
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <memory>
+#include <cstddef>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
@@ -37,14 +57,19 @@ struct Variable {
     int addr;
     bool isArray;       // ǷΪ
     int arraySize;      // С
+    int typeId;         // TypeTableеid-1ʾδǼǣ
+    int fullTypeId;     // TypeTableеid
 
-    Variable() : name(""), type(""), fullType(""), addr(0), isArray(false), arraySize(0) {}
+    Variable() : name(""), type(""), fullType(""), addr(0), isArray(false), arraySize(0),
+        typeId(-1), fullTypeId(-1) {}
 
     Variable(const string& n, const string& t, int a)
-        : name(n), type(t), fullType(t), addr(a), isArray(false), arraySize(0) {}
+        : name(n), type(t), fullType(t), addr(a), isArray(false), arraySize(0),
+        typeId(-1), fullTypeId(-1) {}
 
     Variable(const string& n, const string& t, const string& ft, int a, bool arr, int size)
-        : name(n), type(t), fullType(ft), addr(a), isArray(arr), arraySize(size) {}
+        : name(n), type(t), fullType(ft), addr(a), isArray(arr), arraySize(size),
+        typeId(-1), fullTypeId(-1) {}
 };
 
 
@@ -70,6 +95,338 @@ struct Token {
         : type(t), type_id(tid), val(v), cur_line(line), id(i), constType(ct) {}
 };
 
+// ============================================================================
+// Arena class - ԣbump
+// ڵӴڴ˳з֣ͷΪղ
+// release() һԹ黹ȫڴ顣
+// ============================================================================
+class Arena {
+public:
+    explicit Arena(size_t chunkBytes = 64 * 1024)
+        : chunkSize(chunkBytes), cur(NULL), end(NULL), allocations(0), bytesUsed(0) {}
+
+    ~Arena() {
+        release();
+    }
+
+    void* allocate(size_t bytes, size_t align = sizeof(void*)) {
+        size_t misalign = reinterpret_cast<uintptr_t>(cur) & (align - 1);
+        size_t pad = misalign ? align - misalign : 0;
+        if (cur == NULL || static_cast<size_t>(end - cur) < pad + bytes) {
+            newChunk(bytes + align);
+            misalign = reinterpret_cast<uintptr_t>(cur) & (align - 1);
+            pad = misalign ? align - misalign : 0;
+        }
+        char* p = cur + pad;
+        cur = p + bytes;
+        allocations++;
+        bytesUsed += bytes;
+        return p;
+    }
+
+    // 黹ȫڴ飻߸ԳⲿԴĶ
+    void release() {
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            ::operator delete(chunks[i]);
+        }
+        chunks.clear();
+        cur = NULL;
+        end = NULL;
+        allocations = 0;
+        bytesUsed = 0;
+    }
+
+    size_t allocationCount() const { return allocations; }
+    size_t chunkCount() const { return chunks.size(); }
+    size_t usedBytes() const { return bytesUsed; }
+
+private:
+    size_t chunkSize;
+    char* cur;
+    char* end;
+    vector<char*> chunks;
+    size_t allocations;
+    size_t bytesUsed;
+
+    Arena(const Arena&);
+    Arena& operator=(const Arena&);
+
+    void newChunk(size_t minBytes) {
+        size_t bytes = minBytes > chunkSize ? minBytes : chunkSize;
+        char* chunk = static_cast<char*>(::operator new(bytes));
+        chunks.push_back(chunk);
+        cur = chunk;
+        end = chunk + bytes;
+    }
+};
+
+// STL䣺ڵArena䣻arenaΪNULLʱ˻ȫֶ
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind {
+        typedef ArenaAllocator<U> other;
+    };
+
+    Arena* arena;
+
+    ArenaAllocator() : arena(NULL) {}
+    explicit ArenaAllocator(Arena* a) : arena(a) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    pointer allocate(size_type n, const void* = 0) {
+        if (arena) {
+            return static_cast<pointer>(arena->allocate(n * sizeof(T), alignof(T) > sizeof(void*) ? alignof(T) : sizeof(void*)));
+        }
+        return static_cast<pointer>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(pointer p, size_type) {
+        if (!arena) {
+            ::operator delete(p);
+        }
+    }
+
+    void construct(pointer p, const T& val) { new (p) T(val); }
+    void destroy(pointer p) { p->~T(); }
+    size_type max_size() const { return static_cast<size_type>(-1) / sizeof(T); }
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena != b.arena;
+}
+
+// űͣڵ洢ԱArena
+typedef map<string, Variable, less<string>, ArenaAllocator<pair<const string, Variable> > > VariableDict;
+typedef vector<string, ArenaAllocator<string> > StringList;
+
+typedef vector<int, ArenaAllocator<int> > TypeIdList;
+
+// ============================================================================
+// TypeTable class - פ
+// ÿͬͣintint[10]int[]ṹֻһΣ
+// ֮СidʾԼΪԤȼõľ
+// ============================================================================
+enum TypeKind {
+    TYPE_UNKNOWN,   // δ֪ͣδıʶ
+    TYPE_BASIC,     // int, float, double, char, void
+    TYPE_STRUCT,    // ṹ
+    TYPE_ARRAY,     // 飬baseId ΪԪ
+    TYPE_FUNCTION   // 
+};
+
+struct TypeInfo {
+    string name;    //  int[10]
+    TypeKind kind;
+    int baseId;     // ԪأidΪ
+    int extent;     // 鳤ȣ-1 ʾδָ int[]Ϊ 0
+    int size;       // ֽڴС
+
+    TypeInfo() : name(""), kind(TYPE_UNKNOWN), baseId(0), extent(0), size(0) {}
+};
+
+class TypeTable {
+public:
+    int unknownId;
+    int intId;
+    int floatId;
+    int doubleId;
+    int charId;
+    int voidId;
+    int functionId;
+
+    TypeTable() {
+        unknownId = addType("unknown", TYPE_UNKNOWN, -1, 0, 0);
+        intId = addType("int", TYPE_BASIC, -1, 0, 2);
+        floatId = addType("float", TYPE_BASIC, -1, 0, 4);
+        doubleId = addType("double", TYPE_BASIC, -1, 0, 8);
+        charId = addType("char", TYPE_BASIC, -1, 0, 1);
+        voidId = addType("void", TYPE_BASIC, -1, 0, 0);
+        functionId = addType("function", TYPE_FUNCTION, -1, 0, 0);
+    }
+
+    // ַӦid״γʱǼ
+    int intern(const string& fullType) {
+        map<string, int>::const_iterator it = ids.find(fullType);
+        if (it != ids.end()) {
+            return it->second;
+        }
+
+        size_t bracketPos = fullType.find('[');
+        if (bracketPos != string::npos) {
+            int baseId = intern(fullType.substr(0, bracketPos));
+            int extent = -1;
+            size_t endBracket = fullType.find(']', bracketPos);
+            if (endBracket != string::npos && endBracket > bracketPos + 1) {
+                extent = atoi(fullType.substr(bracketPos + 1, endBracket - bracketPos - 1).c_str());
+            }
+            return arrayOf(baseId, extent);
+        }
+
+        // δ֣ȵǼΪδ֪ܱ֮ͣ declareStruct Ϊṹ
+        return addType(fullType, TYPE_UNKNOWN, -1, 0, 0);
+    }
+
+    int arrayOf(int baseId, int extent) {
+        stringstream ss;
+        ss << types[baseId].name << "[";
+        if (extent >= 0) ss << extent;
+        ss << "]";
+        string name = ss.str();
+
+        map<string, int>::const_iterator it = ids.find(name);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        int size = extent > 0 ? types[baseId].size * extent : 2;   // δָȵ鰴ָ봦
+        return addType(name, TYPE_ARRAY, baseId, extent, size);
+    }
+
+    // Ǽǣ£ṹͼ䵱ǰС
+    int declareStruct(const string& name, int size) {
+        int id = intern(name);
+        TypeInfo& t = types[id];
+        if (t.kind != TYPE_STRUCT) {
+            t.kind = TYPE_STRUCT;
+            rebuildMatrix();
+        }
+        if (t.size != size) {
+            t.size = size;
+            for (size_t i = 0; i < types.size(); ++i) {
+                if (types[i].kind == TYPE_ARRAY && types[i].baseId == id && types[i].extent > 0) {
+                    types[i].size = size * types[i].extent;
+                }
+            }
+        }
+        return id;
+    }
+
+    bool isCompatible(int expected, int actual) const {
+        return compat[expected][actual] != 0;
+    }
+
+    // ͣdouble > float > intcharΪint
+    // δ֪ͻֵͣṹ塢Ϊδ֪
+    int promote(int left, int right) const {
+        int l = types[left].baseId;
+        int r = types[right].baseId;
+        if (!isArithmetic(l) || !isArithmetic(r)) return unknownId;
+        if (l == doubleId || r == doubleId) return doubleId;
+        if (l == floatId || r == floatId) return floatId;
+        return intId;
+    }
+
+    bool isArithmetic(int id) const {
+        return id == intId || id == floatId || id == doubleId || id == charId;
+    }
+
+    const TypeInfo& info(int id) const { return types[id]; }
+    const string& name(int id) const { return types[id].name; }
+    int baseOf(int id) const { return types[id].baseId; }
+    bool isArray(int id) const { return types[id].kind == TYPE_ARRAY; }
+    int sizeOf(int id) const { return types[id].size; }
+    int count() const { return static_cast<int>(types.size()); }
+
+private:
+    vector<TypeInfo> types;
+    map<string, int> ids;
+    vector<vector<unsigned char> > compat;   // compat[expected][actual]
+
+    int addType(const string& name, TypeKind kind, int baseId, int extent, int size) {
+        int id = static_cast<int>(types.size());
+        TypeInfo t;
+        t.name = name;
+        t.kind = kind;
+        t.baseId = baseId < 0 ? id : baseId;
+        t.extent = extent;
+        t.size = size;
+        types.push_back(t);
+        ids[name] = id;
+
+        // չֻڵк
+        for (int i = 0; i < id; ++i) {
+            compat[i].push_back(computeCompatible(i, id) ? 1 : 0);
+        }
+        compat.push_back(vector<unsigned char>(id + 1, 0));
+        for (int j = 0; j <= id; ++j) {
+            compat[id][j] = computeCompatible(id, j) ? 1 : 0;
+        }
+        return id;
+    }
+
+    void rebuildMatrix() {
+        for (size_t i = 0; i < types.size(); ++i) {
+            for (size_t j = 0; j < types.size(); ++j) {
+                compat[i][j] = computeCompatible(static_cast<int>(i), static_cast<int>(j)) ? 1 : 0;
+            }
+        }
+    }
+
+    // ͼݹԭ SYMBOL::isTypeCompatible ַ
+    bool computeCompatible(int expected, int actual) const {
+        // ͬǼ
+        if (expected == actual) return true;
+
+        const string& expectedBase = types[types[expected].baseId].name;
+        const string& actualBase = types[types[actual].baseId].name;
+
+        // ֻϵʽת
+        if (expectedBase == "float" && actualBase == "int") return true;
+        if (expectedBase == "double" && (actualBase == "int" || actualBase == "float")) return true;
+
+        // µʽתfloatint
+        if (expectedBase == "int" && (actualBase == "float" || actualBase == "double")) return false;
+
+        // char͵⴦
+        if (expectedBase == "int" && actualBase == "char") return true;
+        if (expectedBase == "char" && actualBase == "int") return false;
+
+        // ͷͣ鵫ṩ˷鲻ݣΪָʹ
+        bool expectedIsArray = types[expected].kind == TYPE_ARRAY;
+        bool actualIsArray = types[actual].kind == TYPE_ARRAY;
+        if (expectedIsArray && !actualIsArray) return false;
+        if (!expectedIsArray && actualIsArray) return true;
+        // δָȵβΰַⳤȵͬ
+        if (expectedIsArray && actualIsArray && types[expected].extent < 0) {
+            return expectedBase == actualBase;
+        }
+
+        // ṹͱȫƥ
+        if (types[types[expected].baseId].kind == TYPE_STRUCT) {
+            return expectedBase == actualBase;
+        }
+
+        // Ϊ
+        return false;
+    }
+};
+
+class SecTable;
+class Struct;
+class Function;
+typedef vector<Function*, ArenaAllocator<Function*> > FunctionList;
+typedef vector<Struct*, ArenaAllocator<Struct*> > StructList;
+typedef vector<SecTable*, ArenaAllocator<SecTable*> > ScopeList;
+typedef map<string, SecTable*, less<string>, ArenaAllocator<pair<const string, SecTable*> > > SymbolDict;
+
 
 
 // ============================================================================
@@ -77,10 +434,13 @@ struct Token {
 // ============================================================================
 class SecTable {
 public:
-    map<string, Variable> variableDict;
+    VariableDict variableDict;
     int totalSize;
+    TypeTable* types;   // פΪNULL
 
-    SecTable() : totalSize(0) {
+    SecTable(Arena* arena = NULL, TypeTable* typeTable = NULL)
+        : variableDict(less<string>(), ArenaAllocator<pair<const string, Variable> >(arena)), totalSize(0),
+        types(typeTable) {
         cout << "[DEBUG] SecTable constructor called" << endl;
     }
 
@@ -119,6 +479,10 @@ public:
         }
 
         Variable tmp(varName, typ, fullType, totalSize, isArray, arraySize);
+        if (types) {
+            tmp.typeId = types->intern(typ);
+            tmp.fullTypeId = isArray ? types->arrayOf(tmp.typeId, arraySize) : tmp.typeId;
+        }
         totalSize += s;
         variableDict[varName] = tmp;
 
@@ -180,7 +544,8 @@ class Struct : public SecTable {
 public:
     string structName;
 
-    Struct(const string& name) : SecTable(), structName(name) {
+    Struct(const string& name, Arena* arena = NULL, TypeTable* typeTable = NULL)
+        : SecTable(arena, typeTable), structName(name) {
         cout << "[DEBUG] Struct constructor - name: " << name << endl;
     }
 };
@@ -192,15 +557,21 @@ class Function : public SecTable {
 public:
     string functionName;
     int numOfParameters;
-    map<string, Variable> parametersDict;
-    vector<string> typeOfParametersList;
+    VariableDict parametersDict;
+    StringList typeOfParametersList;
     string returnType;
+    int returnTypeId;   // id
 
     // 洢
-    vector<string> parameterTypes;
-
-    Function(const string& name, const string& retType)
-        : SecTable(), functionName(name), numOfParameters(0), returnType(retType) {
+    StringList parameterTypes;
+    TypeIdList parameterTypeIds;   // id
+
+    Function(const string& name, const string& retType, Arena* arena = NULL, TypeTable* typeTable = NULL)
+        : SecTable(arena, typeTable), functionName(name), numOfParameters(0),
+        parametersDict(less<string>(), ArenaAllocator<pair<const string, Variable> >(arena)),
+        typeOfParametersList(ArenaAllocator<string>(arena)), returnType(retType),
+        returnTypeId(typeTable ? typeTable->intern(retType) : -1),
+        parameterTypes(ArenaAllocator<string>(arena)), parameterTypeIds(ArenaAllocator<int>(arena)) {
         cout << "[DEBUG] Function constructor - name: " << name
             << ", return type: " << retType << endl;
     }
@@ -239,9 +610,13 @@ public:
         }
 
         Variable tmp(varName, typ, fullType, -2, isArray, arraySize);
+        if (types) {
+            tmp.typeId = types->intern(typ);
+            tmp.fullTypeId = isArray ? types->arrayOf(tmp.typeId, -1) : tmp.typeId;
+        }
 
         // бַ
-        for (map<string, Variable>::iterator it = variableDict.begin();
+        for (VariableDict::iterator it = variableDict.begin();
             it != variableDict.end(); ++it) {
             Variable& var = it->second;
             var.addr -= 2;
@@ -253,6 +628,9 @@ public:
 
         // ¼ͣʹͣ
         parameterTypes.push_back(fullType);
+        if (types) {
+            parameterTypeIds.push_back(tmp.fullTypeId);
+        }
 
         cout << "[DEBUG] Parameter added. Name: " << varName
             << ", Full type: " << fullType << ", Total parameters: " << numOfParameters << endl;
@@ -260,20 +638,455 @@ public:
     }
 };
 
+// ============================================================================
+// MappedFile - ֻļӳ䣨ļIRļã
+// ============================================================================
+class MappedFile {
+public:
+    MappedFile() : base(NULL), length(0) {
+#ifdef _WIN32
+        fileHandle = INVALID_HANDLE_VALUE;
+        mappingHandle = NULL;
+#endif
+    }
+
+    ~MappedFile() {
+        close();
+    }
+
+    bool open(const string& path) {
+        close();
+
+#ifdef _WIN32
+        fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+            close();
+            return false;
+        }
+        mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mappingHandle == NULL) {
+            close();
+            return false;
+        }
+        base = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        length = static_cast<size_t>(fileSize.QuadPart);
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        void* p = mmap(NULL, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            return false;
+        }
+        base = static_cast<const char*>(p);
+        length = static_cast<size_t>(st.st_size);
+#endif
+        if (base == NULL) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (base) UnmapViewOfFile(base);
+        if (mappingHandle) CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        mappingHandle = NULL;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (base) munmap(const_cast<char*>(base), length);
+#endif
+        base = NULL;
+        length = 0;
+    }
+
+    const char* data() const { return base; }
+    size_t size() const { return length; }
+
+private:
+    const char* base;
+    size_t length;
+#ifdef _WIN32
+    HANDLE fileHandle;
+    HANDLE mappingHandle;
+#endif
+
+    // ֹӳ䣩
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+};
+
+// ============================================================================
+// SymbolFile class - űļڷ룩
+// ļ֣ȫΪ4ֽڶС˼¼
+//   SymbolFileHeader
+//   uint32 stringOffsets[stringCount]
+//   SymbolFileFunction functions[functionCount]
+//   uint32 sortedFunctions[functionCount]   // ±꣬ڶֲ
+//   uint32 parameterTypes[parameterCount]   // ַ±꣨ͣ
+//   SymbolFileStruct structs[structCount]
+//   SymbolFileMember members[memberCount]
+//   char strings[stringBytes]               // '\0'βַ
+// ============================================================================
+struct SymbolFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t stringCount;
+    uint32_t stringBytes;
+    uint32_t functionCount;
+    uint32_t parameterCount;
+    uint32_t structCount;
+    uint32_t memberCount;
+};
+
+struct SymbolFileFunction {
+    uint32_t name;
+    uint32_t returnType;
+    uint32_t firstParameter;
+    uint32_t numOfParameters;
+    int32_t totalSize;
+};
+
+struct SymbolFileStruct {
+    uint32_t name;
+    uint32_t firstMember;
+    uint32_t memberCount;
+    int32_t totalSize;
+};
+
+struct SymbolFileMember {
+    uint32_t name;
+    uint32_t type;
+    uint32_t fullType;
+    int32_t addr;
+    int32_t isArray;
+    int32_t arraySize;
+};
+
+class SymbolFile {
+public:
+    static const uint32_t MAGIC = 0x424D5953;   // "SYMB"
+    static const uint32_t VERSION = 1;
+
+    SymbolFile() : base(NULL), length(0), hdr(NULL), stringOffsets(NULL), functions(NULL),
+        sortedFunctions(NULL), parameterTypes(NULL), structs(NULL), members(NULL), strings(NULL) {
+    }
+
+    ~SymbolFile() {
+        close();
+    }
+
+    // дһ뵥Ԫĺǩṹ岼
+    static bool write(const string& path, const FunctionList& functionList,
+        const StructList& structList) {
+        cout << "[DEBUG] SymbolFile::write - Writing symbol file: " << path << endl;
+
+        vector<string> stringList;
+        map<string, uint32_t> stringIds;
+        vector<SymbolFileFunction> functionRecords;
+        vector<uint32_t> parameterRecords;
+        vector<SymbolFileStruct> structRecords;
+        vector<SymbolFileMember> memberRecords;
+
+        for (size_t i = 0; i < functionList.size(); ++i) {
+            const Function* fun = functionList[i];
+            SymbolFileFunction rec;
+            rec.name = intern(fun->functionName, stringList, stringIds);
+            rec.returnType = intern(fun->returnType, stringList, stringIds);
+            rec.firstParameter = static_cast<uint32_t>(parameterRecords.size());
+            rec.numOfParameters = static_cast<uint32_t>(fun->parameterTypes.size());
+            rec.totalSize = fun->totalSize;
+            for (size_t j = 0; j < fun->parameterTypes.size(); ++j) {
+                parameterRecords.push_back(intern(fun->parameterTypes[j], stringList, stringIds));
+            }
+            functionRecords.push_back(rec);
+        }
+
+        for (size_t i = 0; i < structList.size(); ++i) {
+            const Struct* st = structList[i];
+
+            // ַԱֳԱ˳
+            vector<pair<int, const Variable*> > sortedMembers;
+            for (VariableDict::const_iterator it = st->variableDict.begin();
+                it != st->variableDict.end(); ++it) {
+                sortedMembers.push_back(make_pair(it->second.addr, &(it->second)));
+            }
+            sort(sortedMembers.begin(), sortedMembers.end());
+
+            SymbolFileStruct rec;
+            rec.name = intern(st->structName, stringList, stringIds);
+            rec.firstMember = static_cast<uint32_t>(memberRecords.size());
+            rec.memberCount = static_cast<uint32_t>(sortedMembers.size());
+            rec.totalSize = st->totalSize;
+            for (size_t j = 0; j < sortedMembers.size(); ++j) {
+                const Variable* v = sortedMembers[j].second;
+                SymbolFileMember m;
+                m.name = intern(v->name, stringList, stringIds);
+                m.type = intern(v->type, stringList, stringIds);
+                m.fullType = intern(v->fullType, stringList, stringIds);
+                m.addr = v->addr;
+                m.isArray = v->isArray ? 1 : 0;
+                m.arraySize = v->arraySize;
+                memberRecords.push_back(m);
+            }
+            structRecords.push_back(rec);
+        }
+
+        // ַ
+        vector<uint32_t> stringOffsetList;
+        string stringBytes;
+        for (size_t i = 0; i < stringList.size(); ++i) {
+            stringOffsetList.push_back(static_cast<uint32_t>(stringBytes.size()));
+            stringBytes += stringList[i];
+            stringBytes += '\0';
+        }
+
+        // ĺ±
+        vector<pair<string, uint32_t> > byName;
+        for (size_t i = 0; i < functionList.size(); ++i) {
+            byName.push_back(make_pair(functionList[i]->functionName, static_cast<uint32_t>(i)));
+        }
+        sort(byName.begin(), byName.end());
+        vector<uint32_t> sortedRecords;
+        for (size_t i = 0; i < byName.size(); ++i) {
+            sortedRecords.push_back(byName[i].second);
+        }
+
+        SymbolFileHeader header;
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.stringCount = static_cast<uint32_t>(stringList.size());
+        header.stringBytes = static_cast<uint32_t>(stringBytes.size());
+        header.functionCount = static_cast<uint32_t>(functionRecords.size());
+        header.parameterCount = static_cast<uint32_t>(parameterRecords.size());
+        header.structCount = static_cast<uint32_t>(structRecords.size());
+        header.memberCount = static_cast<uint32_t>(memberRecords.size());
+
+        ofstream out(path.c_str(), ios::out | ios::binary | ios::trunc);
+        if (!out.is_open()) {
+            cout << "[ERROR] Could not create symbol file: " << path << endl;
+            return false;
+        }
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeArray(out, stringOffsetList);
+        writeArray(out, functionRecords);
+        writeArray(out, sortedRecords);
+        writeArray(out, parameterRecords);
+        writeArray(out, structRecords);
+        writeArray(out, memberRecords);
+        out.write(stringBytes.data(), stringBytes.size());
+        out.close();
+
+        cout << "[DEBUG] Symbol file written: " << functionRecords.size() << " functions, "
+            << structRecords.size() << " structs, " << stringList.size() << " strings" << endl;
+        return true;
+    }
+
+    // ֻʽӳļ
+    bool open(const string& path) {
+        cout << "[DEBUG] SymbolFile::open - Mapping symbol file: " << path << endl;
+        close();
+
+        if (!file.open(path)) {
+            cout << "[ERROR] Could not open symbol file: " << path << endl;
+            return false;
+        }
+        base = file.data();
+        length = file.size();
+        if (base == NULL || !validate()) {
+            cout << "[ERROR] Invalid symbol file: " << path << endl;
+            close();
+            return false;
+        }
+
+        cout << "[DEBUG] Symbol file mapped: " << hdr->functionCount << " functions, "
+            << hdr->structCount << " structs" << endl;
+        return true;
+    }
+
+    void close() {
+        file.close();
+        base = NULL;
+        length = 0;
+        hdr = NULL;
+    }
+
+    bool isOpen() const {
+        return hdr != NULL;
+    }
+
+    // ֲңغ¼±꣬δҵ-1
+    int findFunction(const string& name) const {
+        if (!hdr) return -1;
+        int lo = 0;
+        int hi = static_cast<int>(hdr->functionCount) - 1;
+        while (lo <= hi) {
+            int mid = (lo + hi) / 2;
+            uint32_t rec = sortedFunctions[mid];
+            int cmp = strcmp(getString(functions[rec].name), name.c_str());
+            if (cmp == 0) return static_cast<int>(rec);
+            if (cmp < 0) lo = mid + 1;
+            else hi = mid - 1;
+        }
+        return -1;
+    }
+
+    int findStruct(const string& name) const {
+        if (!hdr) return -1;
+        for (uint32_t i = 0; i < hdr->structCount; ++i) {
+            if (name == getString(structs[i].name)) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    int functionCount() const { return hdr ? static_cast<int>(hdr->functionCount) : 0; }
+    int structCount() const { return hdr ? static_cast<int>(hdr->structCount) : 0; }
+
+    const char* functionName(int f) const { return getString(functions[f].name); }
+    const char* returnType(int f) const { return getString(functions[f].returnType); }
+    int numOfParameters(int f) const { return static_cast<int>(functions[f].numOfParameters); }
+    int functionSize(int f) const { return functions[f].totalSize; }
+
+    const char* parameterType(int f, int i) const {
+        return getString(parameterTypes[functions[f].firstParameter + i]);
+    }
+
+    const char* structName(int s) const { return getString(structs[s].name); }
+    int structSize(int s) const { return structs[s].totalSize; }
+    int memberCount(int s) const { return static_cast<int>(structs[s].memberCount); }
+
+    const SymbolFileMember& member(int s, int i) const {
+        return members[structs[s].firstMember + i];
+    }
+
+    const char* getString(uint32_t id) const {
+        return strings + stringOffsets[id];
+    }
+
+private:
+    MappedFile file;
+    const char* base;
+    size_t length;
+    const SymbolFileHeader* hdr;
+    const uint32_t* stringOffsets;
+    const SymbolFileFunction* functions;
+    const uint32_t* sortedFunctions;
+    const uint32_t* parameterTypes;
+    const SymbolFileStruct* structs;
+    const SymbolFileMember* members;
+    const char* strings;
+
+    // ֹӳ䣩
+    SymbolFile(const SymbolFile&);
+    SymbolFile& operator=(const SymbolFile&);
+
+    static uint32_t intern(const string& s, vector<string>& stringList, map<string, uint32_t>& stringIds) {
+        map<string, uint32_t>::iterator it = stringIds.find(s);
+        if (it != stringIds.end()) {
+            return it->second;
+        }
+        uint32_t id = static_cast<uint32_t>(stringList.size());
+        stringList.push_back(s);
+        stringIds[s] = id;
+        return id;
+    }
+
+    template <typename T>
+    static void writeArray(ofstream& out, const vector<T>& items) {
+        if (!items.empty()) {
+            out.write(reinterpret_cast<const char*>(&items[0]), items.size() * sizeof(T));
+        }
+    }
+
+    // Уͷγȣȷӳеλ
+    bool validate() {
+        if (length < sizeof(SymbolFileHeader)) return false;
+        const SymbolFileHeader* h = reinterpret_cast<const SymbolFileHeader*>(base);
+        if (h->magic != MAGIC || h->version != VERSION) return false;
+
+        size_t offset = sizeof(SymbolFileHeader);
+        size_t need = offset
+            + static_cast<size_t>(h->stringCount) * sizeof(uint32_t)
+            + static_cast<size_t>(h->functionCount) * (sizeof(SymbolFileFunction) + sizeof(uint32_t))
+            + static_cast<size_t>(h->parameterCount) * sizeof(uint32_t)
+            + static_cast<size_t>(h->structCount) * sizeof(SymbolFileStruct)
+            + static_cast<size_t>(h->memberCount) * sizeof(SymbolFileMember)
+            + h->stringBytes;
+        if (need != length) return false;
+
+        stringOffsets = reinterpret_cast<const uint32_t*>(base + offset);
+        offset += h->stringCount * sizeof(uint32_t);
+        functions = reinterpret_cast<const SymbolFileFunction*>(base + offset);
+        offset += h->functionCount * sizeof(SymbolFileFunction);
+        sortedFunctions = reinterpret_cast<const uint32_t*>(base + offset);
+        offset += h->functionCount * sizeof(uint32_t);
+        parameterTypes = reinterpret_cast<const uint32_t*>(base + offset);
+        offset += h->parameterCount * sizeof(uint32_t);
+        structs = reinterpret_cast<const SymbolFileStruct*>(base + offset);
+        offset += h->structCount * sizeof(SymbolFileStruct);
+        members = reinterpret_cast<const SymbolFileMember*>(base + offset);
+        offset += h->memberCount * sizeof(SymbolFileMember);
+        strings = base + offset;
+
+        // ַַ'\0'β
+        if (h->stringBytes > 0 && strings[h->stringBytes - 1] != '\0') return false;
+        for (uint32_t i = 0; i < h->stringCount; ++i) {
+            if (stringOffsets[i] >= h->stringBytes) return false;
+        }
+        for (uint32_t i = 0; i < h->functionCount; ++i) {
+            if (functions[i].name >= h->stringCount || functions[i].returnType >= h->stringCount) return false;
+            if (static_cast<uint64_t>(functions[i].firstParameter) + functions[i].numOfParameters > h->parameterCount) return false;
+            if (sortedFunctions[i] >= h->functionCount) return false;
+        }
+        for (uint32_t i = 0; i < h->parameterCount; ++i) {
+            if (parameterTypes[i] >= h->stringCount) return false;
+        }
+        for (uint32_t i = 0; i < h->structCount; ++i) {
+            if (structs[i].name >= h->stringCount) return false;
+            if (static_cast<uint64_t>(structs[i].firstMember) + structs[i].memberCount > h->memberCount) return false;
+        }
+        for (uint32_t i = 0; i < h->memberCount; ++i) {
+            if (members[i].name >= h->stringCount || members[i].type >= h->stringCount ||
+                members[i].fullType >= h->stringCount) return false;
+        }
+
+        hdr = h;
+        return true;
+    }
+};
+
 
 // ============================================================================
 // ǿSYMBOL - ĽͼԼ
 // ============================================================================
 class SYMBOL {
 public:
-    vector<Function*> functionList;
-    vector<Struct*> structList;
-    vector<SecTable*> allList;
-    vector<string> globalNameList;
-    vector<string> structNameList;
-    vector<string> functionNameList;
-    map<string, SecTable*> symDict;
-    vector<string> symbolTableInfo;
+    // αķűArenaӵȫFunction/Structڵ
+    // ǰ֤Ա֮
+    Arena arena;
+
+    FunctionList functionList;
+    StructList structList;
+    ScopeList allList;
+    StringList globalNameList;
+    StringList structNameList;
+    StringList functionNameList;
+    SymbolDict symDict;
 
     // ǰĺ
     Function* currentFunction;
@@ -281,7 +1094,18 @@ public:
     // б
     set<string> basicTypes;
 
-    SYMBOL() : currentFunction(NULL) {
+    // 뵥Ԫļ룩
+    vector<SymbolFile*> importedFiles;
+
+    // פ
+    TypeTable typeTable;
+
+    SYMBOL()
+        : functionList(ArenaAllocator<Function*>(&arena)), structList(ArenaAllocator<Struct*>(&arena)),
+        allList(ArenaAllocator<SecTable*>(&arena)), globalNameList(ArenaAllocator<string>(&arena)),
+        structNameList(ArenaAllocator<string>(&arena)), functionNameList(ArenaAllocator<string>(&arena)),
+        symDict(less<string>(), ArenaAllocator<pair<const string, SecTable*> >(&arena)),
+        currentFunction(NULL) {
         cout << "[DEBUG] SYMBOL constructor called" << endl;
 
         // ʼ
@@ -293,90 +1117,120 @@ public:
     }
 
     ~SYMBOL() {
-        // ̬ڴ
+        // ڴarenaֻڵ黹Ϊղ
+        // ڴarenaʱһͷ
         for (size_t i = 0; i < functionList.size(); ++i) {
-            delete functionList[i];
+            functionList[i]->~Function();
         }
         for (size_t i = 0; i < structList.size(); ++i) {
-            delete structList[i];
+            structList[i]->~Struct();
+        }
+        for (size_t i = 0; i < importedFiles.size(); ++i) {
+            delete importedFiles[i];
         }
     }
 
-    // ĽͼԼ
-    bool isTypeCompatible(const string& expected, const string& actual) {
-        cout << "[DEBUG] SYMBOL::isTypeCompatible - Checking: " << expected << " vs " << actual << endl;
+    // arenaйű
+    Function* newFunction(const string& name, const string& returnType) {
+        return new (arena.allocate(sizeof(Function))) Function(name, returnType, &arena, &typeTable);
+    }
 
-        // ͬǼ
-        if (expected == actual) return true;
+    Struct* newStruct(const string& name) {
+        typeTable.declareStruct(name, 0);
+        return new (arena.allocate(sizeof(Struct))) Struct(name, &arena, &typeTable);
+    }
 
-        // ȡͣȥǣ
-        string expectedBase = extractBaseType(expected);
-        string actualBase = extractBaseType(actual);
+    // 뵥Ԫĺǩṹ岼дƷļ
+    bool saveSymbolFile(const string& path) const {
+        return SymbolFile::write(path, functionList, structList);
+    }
 
-        // ĽĻͼݹ - ϸ
-        // ֻϵʽת
-        if (expectedBase == "float" && actualBase == "int") {
-            return true; // intʽתΪfloat
-        }
-        if (expectedBase == "double" && (actualBase == "int" || actualBase == "float")) {
-            return true; // intfloatʽתΪdouble
-        }
+    // ӳ뵥ԪķļеĽṹ岼ֵǼΪԪõ
+    Message importSymbolFile(const string& path) {
+        cout << "[DEBUG] SYMBOL::importSymbolFile - Importing: " << path << endl;
 
-        // µʽתfloatint
-        if (expectedBase == "int" && (actualBase == "float" || actualBase == "double")) {
-            return false; // ҪĴ
+        SymbolFile* file = new SymbolFile();
+        if (!file->open(path)) {
+            delete file;
+            return Message("Import failed", "", "could not load symbol file '" + path + "'");
         }
 
-        // char͵⴦
-        if (expectedBase == "int" && actualBase == "char") {
-            return true; // charʽתΪint
-        }
-        if (expectedBase == "char" && actualBase == "int") {
-            return false; // intʽתΪchar
+        for (int s = 0; s < file->structCount(); ++s) {
+            string name = file->structName(s);
+            if (find(structNameList.begin(), structNameList.end(), name) != structNameList.end()) {
+                continue;
+            }
+            Struct* st = newStruct(name);
+            for (int m = 0; m < file->memberCount(s); ++m) {
+                const SymbolFileMember& rec = file->member(s, m);
+                string memberName = file->getString(rec.name);
+                Variable v(memberName, file->getString(rec.type),
+                    file->getString(rec.fullType), rec.addr, rec.isArray != 0, rec.arraySize);
+                v.typeId = typeTable.intern(v.type);
+                v.fullTypeId = typeTable.intern(v.fullType);
+                st->variableDict[memberName] = v;
+            }
+            st->totalSize = file->structSize(s);
+            typeTable.declareStruct(name, st->totalSize);
+            structList.push_back(st);
+            structNameList.push_back(name);
+            symDict[name] = st;
         }
 
-        // ͼ
-        bool expectedIsArray = isArrayType(expected);
-        bool actualIsArray = isArrayType(actual);
+        importedFiles.push_back(file);
+        return Message();
+    }
 
-        // ͷͲݣǺ
-        if (expectedIsArray != actualIsArray) {
-            // У˻Ϊָ
-            if (expectedIsArray && !actualIsArray) {
-                return false;  // 鵫ṩ˷
-            }
-            if (!expectedIsArray && actualIsArray) {
-                return true;   // Ϊָʹ
+    // ڵķļвҺؼ¼±겢ͨfileļ
+    int findImportedFunction(const string& funcName, const SymbolFile*& file) const {
+        for (size_t i = 0; i < importedFiles.size(); ++i) {
+            int rec = importedFiles[i]->findFunction(funcName);
+            if (rec >= 0) {
+                file = importedFiles[i];
+                return rec;
             }
         }
+        file = NULL;
+        return -1;
+    }
 
-        // ṹͱȫƥ
-        if (find(structNameList.begin(), structNameList.end(), expectedBase) != structNameList.end()) {
-            return expectedBase == actualBase;
-        }
+    // ĽͼԼ飺ַֻ״γʱ֮Ϊ
+    bool isTypeCompatible(const string& expected, const string& actual) {
+        cout << "[DEBUG] SYMBOL::isTypeCompatible - Checking: " << expected << " vs " << actual << endl;
+        return typeTable.isCompatible(typeTable.intern(expected), typeTable.intern(actual));
+    }
 
-        // Ϊ
-        return false;
+    bool isTypeCompatible(int expected, int actual) const {
+        return typeTable.isCompatible(expected, actual);
     }
 
     // ȡͣȥǣ
     string extractBaseType(const string& fullType) {
-        size_t bracketPos = fullType.find('[');
-        if (bracketPos != string::npos) {
-            return fullType.substr(0, bracketPos);
-        }
-        return fullType;
+        return typeTable.name(typeTable.baseOf(typeTable.intern(fullType)));
     }
 
     // ǷΪ
     bool isArrayType(const string& type) {
-        return type.find('[') != string::npos;
+        return typeTable.isArray(typeTable.intern(type));
     }
 
     // ȡʵͣϢ
     string getVariableType(const Token& token) {
+        return typeTable.name(getVariableTypeId(token));
+    }
+
+    // ȡidʹʱѾãػͣ
+    int getVariableTypeId(const Token& token) {
         string varName = token.val;
 
+        // ṹԱ a.b a ͣڽṹвҳԱ b
+        size_t dotPos = varName.find('.');
+        if (dotPos != string::npos) {
+            Token baseToken = token;
+            baseToken.val = varName.substr(0, dotPos);
+            return getMemberTypeId(getVariableTypeId(baseToken), varName.substr(dotPos + 1));
+        }
+
         // ȥ֣У
         size_t bracketPos = varName.find('[');
         if (bracketPos != string::npos) {
@@ -385,37 +1239,96 @@ public:
 
         // 鵱ǰеľֲ
         if (currentFunction) {
-            map<string, Variable>::iterator it = currentFunction->variableDict.find(varName);
+            VariableDict::iterator it = currentFunction->variableDict.find(varName);
             if (it != currentFunction->variableDict.end()) {
-                // ػͣϢΪʹʱѾã
-                return it->second.type;
+                return it->second.typeId;
             }
         }
 
         // ȫַű
-        map<string, SecTable*>::iterator symIt = symDict.find(varName);
+        SymbolDict::iterator symIt = symDict.find(varName);
         if (symIt != symDict.end()) {
             SecTable* table = symIt->second;
-            if (Function* func = dynamic_cast<Function*>(table)) {
-                return "function";
+            if (dynamic_cast<Function*>(table)) {
+                return typeTable.functionId;
             }
             else if (Struct* st = dynamic_cast<Struct*>(table)) {
-                return st->structName;
+                return typeTable.intern(st->structName);
             }
         }
 
         // ȫֱȫ
-        if (!allList.empty()) {
-            for (vector<SecTable*>::iterator it = allList.begin(); it != allList.end(); ++it) {
-                SecTable* table = *it;
-                map<string, Variable>::iterator varIt = table->variableDict.find(varName);
-                if (varIt != table->variableDict.end()) {
-                    return varIt->second.type;
+        for (ScopeList::iterator it = allList.begin(); it != allList.end(); ++it) {
+            SecTable* table = *it;
+            VariableDict::iterator varIt = table->variableDict.find(varName);
+            if (varIt != table->variableDict.end()) {
+                return varIt->second.typeId;
+            }
+        }
+
+        return typeTable.unknownId;
+    }
+
+    // ʵαʶid±飨ͣ
+    int getArgumentTypeId(const Token& token) {
+        const string& varName = token.val;
+        if (varName.find('[') == string::npos && varName.find('.') == string::npos) {
+            if (currentFunction) {
+                VariableDict::iterator it = currentFunction->variableDict.find(varName);
+                if (it != currentFunction->variableDict.end()) {
+                    return it->second.fullTypeId;
+                }
+            }
+            for (ScopeList::iterator it = allList.begin(); it != allList.end(); ++it) {
+                VariableDict::iterator varIt = (*it)->variableDict.find(varName);
+                if (varIt != (*it)->variableDict.end()) {
+                    return varIt->second.fullTypeId;
                 }
             }
         }
+        return getVariableTypeId(token);
+    }
+
+    // ṹԱidԱԴ±꣬ҲԼʳԱ
+    int getMemberTypeId(int structTypeId, const string& member) {
+        SymbolDict::iterator symIt = symDict.find(typeTable.name(typeTable.baseOf(structTypeId)));
+        Struct* st = symIt != symDict.end() ? dynamic_cast<Struct*>(symIt->second) : NULL;
+        if (!st) {
+            return typeTable.unknownId;
+        }
+
+        string memberName = member;
+        string rest;
+        size_t dotPos = memberName.find('.');
+        if (dotPos != string::npos) {
+            rest = memberName.substr(dotPos + 1);
+            memberName = memberName.substr(0, dotPos);
+        }
+        size_t bracketPos = memberName.find('[');
+        if (bracketPos != string::npos) {
+            memberName = memberName.substr(0, bracketPos);
+        }
+
+        VariableDict::iterator it = st->variableDict.find(memberName);
+        if (it == st->variableDict.end()) {
+            return typeTable.unknownId;
+        }
+        return rest.empty() ? it->second.typeId : getMemberTypeId(it->second.typeId, rest);
+    }
+
+    // idԪӷļ룩
+    int getFunctionReturnTypeId(const string& funcName) {
+        StringList::iterator it = find(functionNameList.begin(), functionNameList.end(), funcName);
+        if (it != functionNameList.end()) {
+            return functionList[distance(functionNameList.begin(), it)]->returnTypeId;
+        }
 
-        return "unknown";
+        const SymbolFile* file = NULL;
+        int rec = findImportedFunction(funcName, file);
+        if (rec >= 0) {
+            return typeTable.intern(file->returnType(rec));
+        }
+        return typeTable.unknownId;
     }
 
     // ෽ֲ...
@@ -450,7 +1363,7 @@ public:
             return message;
         }
 
-        Function* function = new Function(token.val, returnType);
+        Function* function = newFunction(token.val, returnType);
         functionList.push_back(function);
         allList.push_back(function);
         globalNameList.push_back(token.val);
@@ -473,7 +1386,7 @@ public:
             return message;
         }
 
-        Struct* st = new Struct(token.val);
+        Struct* st = newStruct(token.val);
         structList.push_back(st);
         allList.push_back(st);
         globalNameList.push_back(token.val);
@@ -534,24 +1447,10 @@ public:
                 }
             }
 
-            // С
-            int s = 0;
-            if (varType == "int") {
-                s = 2;
-            }
-            else if (varType == "float") {
-                s = 4;
-            }
-            else if (varType == "double") {
-                s = 8;
-            }
-            else if (varType == "char") {
-                s = 1;
-            }
-            else if (find(structNameList.begin(), structNameList.end(), varType) != structNameList.end()) {
-                s = symDict[varType]->totalSize;
-            }
-            else {
+            // Сͱvoidδֲܶ
+            const TypeInfo& typeInfo = typeTable.info(typeTable.intern(varType));
+            int s = typeInfo.size;
+            if (typeInfo.kind != TYPE_STRUCT && (typeInfo.kind != TYPE_BASIC || s == 0)) {
                 // δ֪
                 stringstream ss;
                 ss << "Location:line " << token.cur_line;
@@ -566,9 +1465,16 @@ public:
             }
 
             message = tmp->addVariable(token, varType, s, isArray, arraySize);
-        }
 
-        return message;
+            // ṹԱı˽ṹСͬͱ
+            if (!message.hasError()) {
+                if (Struct* st = dynamic_cast<Struct*>(tmp)) {
+                    typeTable.declareStruct(st->structName, st->totalSize);
+                }
+            }
+        }
+
+        return message;
     }
 
     Message checkDoDefineInFunction(const Token& token) {
@@ -594,36 +1500,53 @@ public:
         const Token& token = RES_TOKEN[id];
         string funcName = token.val;
 
+        // ĲϢԱԪĺķļ
+        int expectedNum = 0;
+        vector<int> expectedTypes;
+
         // 麯Ƿ
         if (find(globalNameList.begin(), globalNameList.end(), funcName) == globalNameList.end()) {
-            stringstream ss;
-            ss << "Location:line " << token.cur_line;
-            string location = ss.str();
+            // ڵķļвң룬½Դ룩
+            const SymbolFile* file = NULL;
+            int rec = findImportedFunction(funcName, file);
+            if (rec < 0) {
+                stringstream ss;
+                ss << "Location:line " << token.cur_line;
+                string location = ss.str();
 
-            string errorMsg = "function '" + funcName + "' has no definition";
-            cout << "[DEBUG] Function not defined: " << funcName << endl;
-            return Message("Unknown identifier", location, errorMsg);
+                string errorMsg = "function '" + funcName + "' has no definition";
+                cout << "[DEBUG] Function not defined: " << funcName << endl;
+                return Message("Unknown identifier", location, errorMsg);
+            }
+
+            cout << "[DEBUG] Function resolved from symbol file: " << funcName << endl;
+            expectedNum = file->numOfParameters(rec);
+            for (int i = 0; i < expectedNum; ++i) {
+                expectedTypes.push_back(typeTable.intern(file->parameterType(rec, i)));
+            }
         }
+        else {
+            // Һ
+            StringList::iterator it = find(functionNameList.begin(), functionNameList.end(), funcName);
+            if (it == functionNameList.end()) {
+                stringstream ss;
+                ss << "Location:line " << token.cur_line;
+                string location = ss.str();
 
-        // Һ
-        vector<string>::iterator it = find(functionNameList.begin(), functionNameList.end(), funcName);
-        if (it == functionNameList.end()) {
-            stringstream ss;
-            ss << "Location:line " << token.cur_line;
-            string location = ss.str();
+                string errorMsg = "'" + funcName + "' is not a function";
+                return Message("Not a function", location, errorMsg);
+            }
 
-            string errorMsg = "'" + funcName + "' is not a function";
-            return Message("Not a function", location, errorMsg);
+            int funcIndex = distance(functionNameList.begin(), it);
+            Function* func = functionList[funcIndex];
+            expectedNum = func->numOfParameters;
+            expectedTypes.assign(func->parameterTypeIds.begin(), func->parameterTypeIds.end());
         }
 
-        int funcIndex = distance(functionNameList.begin(), it);
-        Function* func = functionList[funcIndex];
-
         // ʵʲ
         int para_num = 0;
         int temp_id = id + 1; // 
         vector<Token> argTokens;
-        vector<string> argTypes;
 
         // ȷһtoken '('
         if (temp_id >= static_cast<int>(RES_TOKEN.size()) || RES_TOKEN[temp_id].val != "(") {
@@ -647,55 +1570,57 @@ public:
         }
 
         // 
-        if (func->numOfParameters != para_num) {
+        if (expectedNum != para_num) {
             stringstream ss;
             ss << "Location:line " << token.cur_line;
             string location = ss.str();
 
             string errorMsg = "function '" + funcName + "' expects " +
-                toString(func->numOfParameters) + " arguments, but " +
+                toString(expectedNum) + " arguments, but " +
                 toString(para_num) + " were provided";
             return Message("Argument count mismatch", location, errorMsg);
         }
 
         // ͼ
         for (int i = 0; i < para_num; i++) {
-            string expectedType = func->parameterTypes[i];
-            string actualType = "unknown";
+            int expectedType = expectedTypes[i];
+            int actualType = typeTable.unknownId;
             const Token& argToken = argTokens[i];
 
             // ȷʵʲ
-            if (argToken.type == "con") {
-                // ǷΪ
-                if (argToken.val.find('.') != string::npos) {
-                    actualType = "float";
-                }
-                else {
-                    actualType = "int";
-                }
+            if (argToken.type == "int_con") {
+                actualType = typeTable.intId;
+            }
+            else if (argToken.type == "float_con") {
+                actualType = typeTable.floatId;
+            }
+            else if (argToken.type == "char_con") {
+                actualType = typeTable.charId;
             }
             else if (argToken.type == "i") {
-                // ʶұ
-                actualType = getVariableType(argToken);
+                // ʶұͣ飩
+                actualType = getArgumentTypeId(argToken);
             }
             else if (argToken.type == "s") {
-                // ַ
-                actualType = "char[]";  // ַַ
+                // ַַ飩
+                actualType = typeTable.arrayOf(typeTable.charId, -1);
             }
             else if (argToken.type == "c") {
                 // ַ
-                actualType = "char";
+                actualType = typeTable.charId;
             }
 
-            // ͼ
-            if (!isTypeCompatible(expectedType, actualType)) {
+            // ͼԣͱеļݾO(1)ûָ룬
+            // 鲻Ϊβεʵ
+            bool arrayForScalar = typeTable.isArray(actualType) && !typeTable.isArray(expectedType);
+            if (arrayForScalar || !isTypeCompatible(expectedType, actualType)) {
                 stringstream ss;
                 ss << "Location:line " << argToken.cur_line;
                 string location = ss.str();
 
                 string errorMsg = "argument " + toString(i + 1) + " of function '" + funcName +
-                    "' has incompatible type: expected '" + expectedType +
-                    "', got '" + actualType + "'";
+                    "' has incompatible type: expected '" + typeTable.name(expectedType) +
+                    "', got '" + typeTable.name(actualType) + "'";
                 return Message("Type mismatch", location, errorMsg);
             }
         }
@@ -703,75 +1628,53 @@ public:
         return Message();
     }
 
-    void showTheInfo() {
-        cout << "[DEBUG] SYMBOL::showTheInfo - Generating symbol table info" << endl;
-
-        symbolTableInfo.clear();
-
+    // űֱдƴַб
+    void writeTheInfo(ostream& out) {
         // Ϣ
         for (size_t i = 0; i < functionList.size(); ++i) {
             Function* fun = functionList[i];
 
-            stringstream ss;
-            ss << "FuncName:" << fun->functionName
+            out << "FuncName:" << fun->functionName
                 << " ReturnType:" << fun->returnType
                 << " NumOfParameters:" << fun->numOfParameters
-                << " Size:" << fun->totalSize;
-            symbolTableInfo.push_back(ss.str());
+                << " Size:" << fun->totalSize << '\n';
 
             // ʾ
             if (fun->numOfParameters > 0) {
-                ss.str("");
-                ss << "    ParameterTypes:";
+                out << "    ParameterTypes:";
                 for (size_t j = 0; j < fun->parameterTypes.size(); ++j) {
-                    if (j > 0) ss << ", ";
-                    ss << fun->parameterTypes[j];
+                    if (j > 0) out << ", ";
+                    out << fun->parameterTypes[j];
                 }
-                symbolTableInfo.push_back(ss.str());
+                out << '\n';
             }
 
             // ʾϢ
-            for (map<string, Variable>::iterator it = fun->variableDict.begin();
-                it != fun->variableDict.end(); ++it) {
-                const Variable& v = it->second;
-                stringstream vss;
-                vss << "    VariableName:" << v.name
-                    << " Type:" << v.type
-                    << " FullType:" << v.fullType
-                    << " Addr:" << v.addr;
-                if (v.isArray) {
-                    vss << " IsArray:true Size:" << v.arraySize;
-                }
-                symbolTableInfo.push_back(vss.str());
-            }
+            writeVariables(out, fun->variableDict);
         }
 
         // ṹϢ
         for (size_t i = 0; i < structList.size(); ++i) {
             Struct* st = structList[i];
 
-            stringstream ss;
-            ss << "StructName:" << st->structName
-                << " Size:" << st->totalSize;
-            symbolTableInfo.push_back(ss.str());
+            out << "StructName:" << st->structName
+                << " Size:" << st->totalSize << '\n';
+            writeVariables(out, st->variableDict);
+        }
+    }
 
-            for (map<string, Variable>::iterator it = st->variableDict.begin();
-                it != st->variableDict.end(); ++it) {
-                const Variable& v = it->second;
-                stringstream vss;
-                vss << "    VariableName:" << v.name
-                    << " Type:" << v.type
-                    << " FullType:" << v.fullType
-                    << " Addr:" << v.addr;
-                if (v.isArray) {
-                    vss << " IsArray:true Size:" << v.arraySize;
-                }
-                symbolTableInfo.push_back(vss.str());
+    void writeVariables(ostream& out, const VariableDict& variableDict) {
+        for (VariableDict::const_iterator it = variableDict.begin(); it != variableDict.end(); ++it) {
+            const Variable& v = it->second;
+            out << "    VariableName:" << v.name
+                << " Type:" << v.type
+                << " FullType:" << v.fullType
+                << " Addr:" << v.addr;
+            if (v.isArray) {
+                out << " IsArray:true Size:" << v.arraySize;
             }
+            out << '\n';
         }
-
-        cout << "[DEBUG] Symbol table info generated with "
-            << symbolTableInfo.size() << " entries" << endl;
     }
 
     // ǰķ
@@ -1588,8 +2491,10 @@ private:
     SYMBOL syn_table;
     vector<vector<Token> > funcBlocks;
 
-    // ʽƵ
-    map<int, string> exprTypeCache;
+    // ջ﷨ʱԵϼıʽid
+    vector<int> typeStack;
+    // δɼĸֵ=+= ȣ
+    vector<Token> assignOps;
 
 protected:
     virtual string getAnalysisTableName() {
@@ -1610,6 +2515,8 @@ public:
     LL1(const string& path, bool doseIniList = false) : GrammarParser(path) {
         cout << "[DEBUG] LL1 constructor called" << endl;
 
+        addTypeActions();
+
         if (doseIniList) {
             initList();
         }
@@ -1634,105 +2541,6 @@ public:
         }
     }
 
-    // ޸ĺıʽƵ - ʹµ token 
-    string inferExpressionType(int startId, int endId) {
-        cout << "[DEBUG] LL1::inferExpressionType - Inferring type from " << startId << " to " << endId << endl;
-
-        if (startId >= static_cast<int>(RES_TOKEN.size()) || endId >= static_cast<int>(RES_TOKEN.size())) {
-            return "unknown";
-        }
-
-        // 黺
-        if (exprTypeCache.find(startId) != exprTypeCache.end()) {
-            return exprTypeCache[startId];
-        }
-
-        // token
-        if (startId == endId) {
-            Token& token = RES_TOKEN[startId];
-            string type = "unknown";
-
-            // ʹµĳ
-            if (token.type == "int_con") {
-                type = "int";
-            }
-            else if (token.type == "float_con") {
-                type = "float";
-            }
-            else if (token.type == "char_con") {
-                type = "char";
-            }
-            else if (token.type == "i") {
-                // ʶ
-                type = syn_table.getVariableType(token);
-            }
-            else if (token.type == "s") {
-                type = "char[]";
-            }
-
-            exprTypeCache[startId] = type;
-            return type;
-        }
-
-        // ӱʽҪͲ
-        string resultType = "unknown";
-        bool hasFloat = false;
-        bool hasDouble = false;
-        bool hasChar = false;
-
-        for (int i = startId; i <= endId; i++) {
-            Token& token = RES_TOKEN[i];
-
-            if (token.type == "int_con" || token.type == "float_con" ||
-                token.type == "char_con" || token.type == "i") {
-                string tokenType = inferExpressionType(i, i);
-                if (tokenType == "float") hasFloat = true;
-                else if (tokenType == "double") hasDouble = true;
-                else if (tokenType == "char") hasChar = true;
-            }
-        }
-
-        // 
-        if (hasDouble) {
-            resultType = "double";
-        }
-        else if (hasFloat) {
-            resultType = "float";
-        }
-        else if (hasChar && !hasFloat && !hasDouble) {
-            // ֻcharintʱΪint
-            resultType = "int";
-        }
-        else {
-            resultType = "int"; // ĬΪint
-        }
-
-        exprTypeCache[startId] = resultType;
-        return resultType;
-    }
-
-    // ҸֵҲʽΧ
-    pair<int, int> findAssignmentRHS(int assignOpId) {
-        int start = assignOpId + 1;
-        int end = start;
-
-        // ҵֺŻֹ
-        while (end < static_cast<int>(RES_TOKEN.size())) {
-            if (RES_TOKEN[end].val == ";" || RES_TOKEN[end].val == "," ||
-                RES_TOKEN[end].val == ")") {
-                end--;
-                break;
-            }
-            end++;
-        }
-
-        if (end >= static_cast<int>(RES_TOKEN.size())) {
-            end = RES_TOKEN.size() - 1;
-        }
-
-        return make_pair(start, end);
-    }
-
     Message analyzeInputString() {
         cout << "[DEBUG] LL1::analyzeInputString - Starting syntax analysis" << endl;
 
@@ -1752,6 +2560,9 @@ public:
         funcBlock.push_back(token);
 
         string w = getTokenVal(token);
+        Token matched = token;   // ƥսͶʹ
+        typeStack.clear();
+        assignOps.clear();
 
         while (!stack.empty()) {
             string x = stack.back();
@@ -1759,6 +2570,15 @@ public:
 
             cout << "[DEBUG] Stack top: " << x << ", Current token: " << w << endl;
 
+            // Զ
+            if (!x.empty() && x[0] == '@') {
+                Message message = typeAction(x, matched);
+                if (message.hasError()) {
+                    return message;
+                }
+                continue;
+            }
+
             if (x != w) {
                 if (VN.find(x) == VN.end()) {
                     // xսƥ
@@ -1813,9 +2633,9 @@ public:
             }
             else {
                 // ƥɹ
+                matched = token;
                 if (w == "#") {
                     funcBlocks.push_back(funcBlock);
-                    syn_table.showTheInfo();
                     return Message(); // ɹ
                 }
 
@@ -1918,11 +2738,6 @@ private:
             }
         }
 
-        // ֵͼ
-        if (w == "=" && token.val == "=") {
-            return checkAssignmentType(token);
-        }
-
         if (x == "NormalStatement" || (x == "F" && w == "ID")) {
             // ʹü
             if (token.val.find('.') == string::npos && token.val.find('[') == string::npos) {
@@ -1930,14 +2745,6 @@ private:
             }
         }
 
-        // ϸֵ
-        if (x == "CompoundAssignOp") {
-            // ڸϸֵҲҪͼ
-            if (token.val == "+=" || token.val == "-=" || token.val == "*=" || token.val == "/=") {
-                return checkCompoundAssignmentType(token);
-            }
-        }
-
         // ׺
         if (x == "PostfixOp") {
             // ں׺++/--ҪǰıǷѶ
@@ -1975,8 +2782,131 @@ private:
         return Message();
     }
 
-    // 鸳ֵͼ
-    Message checkAssignmentType(const Token& assignOp) {
+    // ķıʽʽвԶıʽţӰ죩
+    //   F ѲѹջA/B е @TY_BIN Ͳѹͣ
+    //    Operation ʱջʽͣÿʽֻһΡ
+    void addTypeActions() {
+        const char* actions[][3] = {
+            { "NormalStatementFollow", "= Operation ;", "= @TY_OP Operation @TY_ASSIGN ;" },
+            { "NormalStatementFollow", "+= Operation ;", "+= @TY_OP Operation @TY_COMPOUND ;" },
+            { "NormalStatementFollow", "-= Operation ;", "-= @TY_OP Operation @TY_COMPOUND ;" },
+            { "NormalStatementFollow", "*= Operation ;", "*= @TY_OP Operation @TY_COMPOUND ;" },
+            { "NormalStatementFollow", "/= Operation ;", "/= @TY_OP Operation @TY_COMPOUND ;" },
+            { "Code", "return Operation ;", "return Operation @TY_POP ;" },
+            { "A", "M T A", "M T @TY_BIN A" },
+            { "B", "N F B", "N F @TY_BIN B" },
+            { "F", "ID", "ID @TY_ID" },
+            { "F", "NUM", "NUM @TY_NUM" },
+            { "F", "++ ID", "++ ID @TY_ID" },
+            { "F", "-- ID", "-- ID @TY_ID" },
+            { "JudgeStatement", "Operation JudgeStatementFollow", "Operation JudgeStatementFollow @TY_POP" },
+            { "JudgeStatementFollow", "CompareSymbol Operation", "CompareSymbol Operation @TY_CMP" },
+            { "FuncCallFollow", "= ID ( Args )", "= @TY_OP ID @TY_CALL ( Args ) @TY_ASSIGN" },
+            { "Args", "F ArgsFollow", "F @TY_POP ArgsFollow" },
+            { "ArgsFollow", ", F ArgsFollow", ", F @TY_POP ArgsFollow" }
+        };
+        int numActions = sizeof(actions) / sizeof(actions[0]);
+        vector<bool> applied(numActions, false);
+
+        for (size_t i = 0; i < P_LIST.size(); ++i) {
+            string right;
+            for (size_t j = 0; j < P_LIST[i].second.size(); ++j) {
+                right += (j ? " " : "") + P_LIST[i].second[j];
+            }
+
+            for (int k = 0; k < numActions; ++k) {
+                if (P_LIST[i].first != actions[k][0] || right != actions[k][1]) continue;
+
+                vector<string> tmp;
+                stringstream ss(actions[k][2]);
+                string symbol;
+                while (ss >> symbol) {
+                    tmp.push_back(symbol);
+                }
+
+                vector<vector<string> >& alternatives = GRAMMAR_DICT[P_LIST[i].first];
+                for (size_t j = 0; j < alternatives.size(); ++j) {
+                    if (alternatives[j] == P_LIST[i].second) {
+                        alternatives[j] = tmp;
+                        break;
+                    }
+                }
+                P_LIST[i].second = tmp;
+                applied[k] = true;
+                break;
+            }
+        }
+
+        // ķļеĲʽϱһʱӦͼʧЧ뱨
+        int missing = 0;
+        for (int k = 0; k < numActions; ++k) {
+            if (applied[k]) continue;
+            cout << "[ERROR] Type action not applied, production not found in grammar: "
+                << actions[k][0] << " -> " << actions[k][1] << endl;
+            missing++;
+        }
+        if (missing > 0) {
+            cout << "[ERROR] " << missing << " of " << numActions
+                << " type actions not applied; expression type checking is incomplete" << endl;
+        }
+    }
+
+    int popType() {
+        if (typeStack.empty()) {
+            return syn_table.typeTable.unknownId;
+        }
+        int type = typeStack.back();
+        typeStack.pop_back();
+        return type;
+    }
+
+    // ִԶmatched Ϊƥս
+    Message typeAction(const string& action, const Token& matched) {
+        TypeTable& types = syn_table.typeTable;
+
+        if (action == "@TY_ID") {
+            typeStack.push_back(syn_table.getVariableTypeId(matched));
+        }
+        else if (action == "@TY_NUM") {
+            if (matched.type == "float_con") typeStack.push_back(types.floatId);
+            else if (matched.type == "char_con") typeStack.push_back(types.charId);
+            else typeStack.push_back(types.intId);
+        }
+        else if (action == "@TY_CALL") {
+            typeStack.push_back(syn_table.getFunctionReturnTypeId(matched.val));
+        }
+        else if (action == "@TY_BIN") {
+            int right = popType();
+            int left = popType();
+            typeStack.push_back(types.promote(left, right));
+        }
+        else if (action == "@TY_CMP") {
+            popType();
+            popType();
+            typeStack.push_back(types.intId);
+        }
+        else if (action == "@TY_POP") {
+            popType();
+        }
+        else if (action == "@TY_OP") {
+            assignOps.push_back(matched);
+        }
+        else if (action == "@TY_ASSIGN" || action == "@TY_COMPOUND") {
+            int rhsType = popType();
+            if (assignOps.empty()) {
+                return Message();
+            }
+            Token op = assignOps.back();
+            assignOps.pop_back();
+            return action == "@TY_ASSIGN" ? checkAssignmentType(op, rhsType)
+                : checkCompoundAssignmentType(op, rhsType);
+        }
+
+        return Message();
+    }
+
+    // 鸳ֵͼԣҲʽԶ
+    Message checkAssignmentType(const Token& assignOp, int rhsType) {
         cout << "[DEBUG] LL1::checkAssignmentType - Checking assignment at token " << assignOp.id << endl;
 
         if (assignOp.id == 0) {
@@ -1990,20 +2920,15 @@ private:
         }
 
         // ȡ
-        string lhsType = syn_table.getVariableType(lhsToken);
-        if (lhsType == "unknown") {
+        TypeTable& types = syn_table.typeTable;
+        int lhsType = syn_table.getVariableTypeId(lhsToken);
+        if (lhsType == types.unknownId) {
             // δĴѾط
             return Message();
         }
 
-        // ȡҲʽΧ
-        pair<int, int> rhsRange = findAssignmentRHS(assignOp.id);
-
-        // ƵҲʽ
-        string rhsType = inferExpressionType(rhsRange.first, rhsRange.second);
-
         cout << "[DEBUG] Assignment type check: " << lhsToken.val
-            << " (" << lhsType << ") = expression (" << rhsType << ")" << endl;
+            << " (" << types.name(lhsType) << ") = expression (" << types.name(rhsType) << ")" << endl;
 
         // ͼ
         if (!syn_table.isTypeCompatible(lhsType, rhsType)) {
@@ -2011,11 +2936,11 @@ private:
             ss << "Location:line " << assignOp.cur_line;
             string location = ss.str();
 
-            string errorMsg = "type mismatch in assignment: cannot assign '" + rhsType +
-                "' to variable '" + lhsToken.val + "' of type '" + lhsType + "'";
+            string errorMsg = "type mismatch in assignment: cannot assign '" + types.name(rhsType) +
+                "' to variable '" + lhsToken.val + "' of type '" + types.name(lhsType) + "'";
 
             // رʾ
-            if (lhsType == "int" && rhsType == "float") {
+            if (lhsType == types.intId && rhsType == types.floatId) {
                 errorMsg += " (possible loss of precision)";
             }
 
@@ -2026,7 +2951,7 @@ private:
     }
 
     // 鸴ϸֵͼ
-    Message checkCompoundAssignmentType(const Token& compoundOp) {
+    Message checkCompoundAssignmentType(const Token& compoundOp, int rhsType) {
         cout << "[DEBUG] LL1::checkCompoundAssignmentType - Checking compound assignment" << endl;
 
         if (compoundOp.id == 0) {
@@ -2040,15 +2965,12 @@ private:
         }
 
         // ȡ
-        string lhsType = syn_table.getVariableType(lhsToken);
-        if (lhsType == "unknown") {
+        TypeTable& types = syn_table.typeTable;
+        int lhsType = syn_table.getVariableTypeId(lhsToken);
+        if (lhsType == types.unknownId) {
             return Message();
         }
 
-        // ȡҲʽ
-        pair<int, int> rhsRange = findAssignmentRHS(compoundOp.id);
-        string rhsType = inferExpressionType(rhsRange.first, rhsRange.second);
-
         // ڸϸֵǷ
         if (!syn_table.isTypeCompatible(lhsType, rhsType)) {
             stringstream ss;
@@ -2056,7 +2978,7 @@ private:
             string location = ss.str();
 
             string errorMsg = "type mismatch in compound assignment: cannot apply '" +
-                compoundOp.val + "' between '" + lhsType + "' and '" + rhsType + "'";
+                compoundOp.val + "' between '" + types.name(lhsType) + "' and '" + types.name(rhsType) + "'";
 
             return Message("Type mismatch", location, errorMsg);
         }
@@ -2065,11 +2987,106 @@ private:
     }
 
 public:
-    void printSymbolTable() {
-        syn_table.showTheInfo();
-        cout << "\n[DEBUG] Symbol Table Information:" << endl;
-        for (size_t i = 0; i < syn_table.symbolTableInfo.size(); ++i) {
-            cout << syn_table.symbolTableInfo[i] << endl;
+    // űֻڵʱʽ--dump-symbols ÷Ҫʱ
+    void printSymbolTable(ostream& out = cout) {
+        syn_table.writeTheInfo(out);
+        out.flush();
+    }
+};
+
+// ============================================================================
+// б֧
+// űɺֻԪʽɡŻͻɻ
+// Խ̳߳زִСÿĵдԼĻ
+// ȫɺ󰴺˳֤봮ģʽֽһ¡
+// ============================================================================
+// ǰ̵߳ĵNULL ʾֱ cout
+static thread_local ostream* debugStream = NULL;
+
+inline ostream& dbgOut() {
+    return debugStream ? *debugStream : cout;
+}
+
+class ThreadPool {
+public:
+    explicit ThreadPool(int threads)
+        : stopping(false), task(NULL), logs(NULL), count(0), next(0), pending(0) {
+        for (int i = 0; i < threads; ++i) {
+            workers.push_back(thread(&ThreadPool::workerLoop, this));
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(m);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (size_t i = 0; i < workers.size(); ++i) {
+            workers[i].join();
+        }
+    }
+
+    int size() const { return static_cast<int>(workers.size()); }
+
+    // ִ fn(0) .. fn(n-1) ȴȫɣظĵ±
+    vector<string> run(size_t n, const function<void(size_t)>& fn) {
+        vector<string> res(n);
+        unique_lock<mutex> lock(m);
+        task = &fn;
+        logs = &res;
+        count = n;
+        next = 0;
+        pending = n;
+        wake.notify_all();
+        while (pending > 0) {
+            done.wait(lock);
+        }
+        task = NULL;
+        logs = NULL;
+        return res;
+    }
+
+private:
+    vector<thread> workers;
+    mutex m;
+    condition_variable wake;
+    condition_variable done;
+    bool stopping;
+    const function<void(size_t)>* task;
+    vector<string>* logs;
+    size_t count;
+    size_t next;
+    size_t pending;
+
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+    void workerLoop() {
+        unique_lock<mutex> lock(m);
+        while (true) {
+            while (!stopping && next >= count) {
+                wake.wait(lock);
+            }
+            if (stopping) {
+                return;
+            }
+
+            size_t i = next++;
+            const function<void(size_t)>* fn = task;
+            vector<string>* out = logs;
+            lock.unlock();
+
+            stringstream buf;
+            debugStream = &buf;
+            (*fn)(i);
+            debugStream = NULL;
+
+            lock.lock();
+            (*out)[i] = buf.str();
+            if (--pending == 0) {
+                done.notify_all();
+            }
         }
     }
 };
@@ -2087,171 +3104,3939 @@ struct Quaternion {
         : op(o), arg1(a1), arg2(a2), result(r) {}
 };
 // ============================================================================
-// QtGen class (ȫƵԪʽ)
+// ԪʽIR
+// ÿָ16ֽڣö + 32λǩĲʱšid
+// šԪ/ṹԱã֡ô
+// ԼıУָֻ±ꡣIRAdapter ַԪʽת
+// QtGenOptimizationAsmCodeGen ǨƵֱʾϡ
 // ============================================================================
-class QtGen : public GrammarParser {
-private:
-    SYMBOL* syn_table;
-    int t_id;
-    vector<vector<Quaternion> > qt_res;
+enum IROpcode {
+    IR_NOP,
+    IR_FUN,         // (FUN, , _, _)
+    IR_ASSIGN,      // (=, Դ, _, Ŀ)
+    IR_ADD, IR_SUB, IR_MUL, IR_DIV,
+    IR_GT, IR_LT, IR_GE, IR_LE, IR_EQ, IR_NE,
+    IR_IF, IR_ELIF, IR_EL, IR_IE,   // 
+    IR_WH, IR_DO, IR_WE,            // ѭ
+    IR_BREAK, IR_CONTINUE, IR_RETURN,
+    IR_PUSH, IR_CALL, IR_CALLR,
+    IR_BR,          // ںϵıȽת (if<, a, b, LĿ)auxΪȽϲ룬flagsΪ滻 if/elif/do
+    IR_RAW,         // δ֪ԭıڲԭı rawOps УauxΪ±꣩
+    IR_OPCODE_COUNT
+};
 
-protected:
-    virtual string getAnalysisTableName() {
-        return "TranslationAnalysisTable.txt";
-    }
+static const char* const IR_OPCODE_NAMES[IR_OPCODE_COUNT] = {
+    "nop", "FUN", "=", "+", "-", "*", "/",
+    ">", "<", ">=", "<=", "==", "!=",
+    "if", "elif", "el", "ie", "wh", "do", "we",
+    "break", "continue", "return", "push", "call", "callr", "br", "raw"
+};
 
-public:
-    QtGen(SYMBOL* syn, const string& grammarPath = "")
-        : GrammarParser(grammarPath), syn_table(syn), t_id(0) {
-        cout << "[DEBUG] QtGen constructor called" << endl;
+enum IROperandKind {
+    IRO_NONE,       // "_"
+    IRO_TEMP,       // @tNغΪN
+    IRO_SYM,        // /غΪֱ±
+    IRO_IMM,        // 28λз
+    IRO_CONST,      // ΧغΪ±
+    IRO_LABEL,      // 
+    IRO_REF         // Ԫ a[i] ṹԱ s.xغΪñ±
+};
 
-        // ûṩķ·ʹĬϵķķ
-        if (grammarPath.empty()) {
-            loadEmbeddedTranslationGrammar();
-        }
+struct IROperand {
+    uint32_t bits;  // 4λΪ࣬28λΪغ
 
-        // 
-        initList();
+    IROperand() : bits(0) {}
+
+    static IROperand make(IROperandKind kind, uint32_t payload) {
+        IROperand o;
+        o.bits = (static_cast<uint32_t>(kind) << 28) | (payload & 0x0FFFFFFFu);
+        return o;
     }
 
-    // ȡԪʽ
-    vector<vector<Quaternion> > getQtRes() const {
-        return qt_res;
+    static IROperand imm(int value) {
+        return make(IRO_IMM, static_cast<uint32_t>(value));
     }
 
-    // Ԫʽ
-    void genQt(const vector<Token>& funcBlock) {
-        cout << "[DEBUG] QtGen::genQt - Generating quaternions for function block" << endl;
+    static bool fitsImm(long value) {
+        return value >= -(1L << 27) && value < (1L << 27);
+    }
 
-        vector<Quaternion> qtList;
-        vector<string> SEM_STACK;     // ջ
-        vector<string> SYMBOL_STACK;  // ջ
-        vector<string> SYN;           // ﷨ջ
+    IROperandKind kind() const { return static_cast<IROperandKind>(bits >> 28); }
+    uint32_t index() const { return bits & 0x0FFFFFFFu; }
+    int immValue() const { return static_cast<int>(bits << 4) >> 4; }   // չ
+    bool isNone() const { return bits == 0; }
 
-        // tokenջڸƥtokens
-        vector<Token> MATCHED_TOKENS;
+    bool operator==(const IROperand& other) const { return bits == other.bits; }
+    bool operator!=(const IROperand& other) const { return bits != other.bits; }
+};
 
-        SYN.push_back("#");
-        SYN.push_back(Z);
+// ãbase[index]  base.member
+struct IRRef {
+    uint32_t base;      // ֱ±
+    IROperand index;    // ±꣬Ϊ IRO_NONE
+    uint32_t member;    // Ա±꣬޳ԱΪ IR_NO_MEMBER
+};
 
-        // tokenб
-        vector<Token> TokenList = funcBlock;
-        Token endToken("p", 0, "#", 0, static_cast<int>(funcBlock.size()));
-        TokenList.push_back(endToken);
+static const uint32_t IR_NO_MEMBER = 0xFFFFFFFFu;
 
-        t_id = 0;
+struct IRInst {
+    uint8_t op;         // IROpcode
+    uint8_t flags;      // ʹõı־λ
+    uint16_t aux;       // ϢIR_RAW Ĳԭ±ȣ
+    IROperand a;
+    IROperand b;
+    IROperand r;
 
-        if (TokenList.empty()) {
-            cout << "[WARNING] Empty token list" << endl;
-            return;
-        }
+    IRInst() : op(IR_NOP), flags(0), aux(0) {}
+    IRInst(IROpcode o, IROperand x, IROperand y, IROperand res)
+        : op(static_cast<uint8_t>(o)), flags(0), aux(0), a(x), b(y), r(res) {}
 
-        size_t tokenIndex = 0;
-        Token token = TokenList[tokenIndex++];
-        string w = getTokenVal(token);
+    IROpcode opcode() const { return static_cast<IROpcode>(op); }
 
-        while (!SYN.empty()) {
-            string x = SYN.back();
-            SYN.pop_back();
+    // ṹеĽɫںϵıȽת滻 if/elif/do Ǵ
+    IROpcode marker() const { return op == IR_BR ? static_cast<IROpcode>(flags) : opcode(); }
+};
 
-            cout << "[DEBUG] Stack top: " << x << ", Current token: " << w << " (val: " << token.val << ")" << endl;
+static_assert(sizeof(IROperand) == 4, "IROperand must stay 4 bytes");
+static_assert(sizeof(IRInst) == 16, "IRInst must stay 16 bytes");
 
-            // 嶯
-            if (!x.empty() && x[0] == '@') {
-                catchAction(x, MATCHED_TOKENS, SYMBOL_STACK, SEM_STACK, qtList);
-                continue;
-            }
+struct IRNameLess {
+    bool operator()(const char* a, const char* b) const { return strcmp(a, b) < 0; }
+};
 
-            if (x != w) {
-                // xǷսҲʽ
-                if (VN.find(x) != VN.end()) {
-                    if (analysis_table.find(x) != analysis_table.end() &&
-                        analysis_table[x].find(w) != analysis_table[x].end()) {
+typedef vector<IRInst> IRCode;
+typedef vector<uint32_t> IRIndexList;
+typedef vector<const char*> IRNameList;
+typedef vector<IRRef> IRRefList;
+typedef map<const char*, uint32_t, IRNameLess, ArenaAllocator<pair<const char* const, uint32_t> > > IRNameIds;
+
+// һIRָԼõı
+// ֺͳֲַұĽڵֻɾӺԼArena䣻
+//  vectorָ黮֡дݣArenaվɻ
+// Էͨ vector СIRFunction 
+// QtGenOptimizationAsmCodeGen ֮䰴ָ봫ݣɺͷš
+class IRFunction {
+public:
+    Arena arena;
+    string name;
+    IRCode code;
+    IRIndexList blockStarts;    // ʼָ±꣨Ż󻮷֣Ϊձʾδ
+    IRNameList names;
+    IRNameList consts;
+    IRRefList refs;
+    IRNameList rawOps;          // IR_RAW ĲԭģŽֱı
+
+    IRFunction()
+        : arena(4096),
+        nameIds(IRNameLess(), ArenaAllocator<pair<const char* const, uint32_t> >(&arena)) {}
+
+    IROperand symbol(const string& text) {
+        IRNameIds::const_iterator it = nameIds.find(text.c_str());
+        if (it != nameIds.end()) {
+            return IROperand::make(IRO_SYM, it->second);
+        }
+        uint32_t id = static_cast<uint32_t>(names.size());
+        const char* copy = copyString(text);
+        names.push_back(copy);
+        nameIds[copy] = id;
+        return IROperand::make(IRO_SYM, id);
+    }
 
-                        int id = analysis_table[x][w];
-                        if (id >= 0 && id < static_cast<int>(P_LIST.size())) {
-                            const vector<string>& tmp = P_LIST[id].second;
+    // Χԭı
+    IROperand constant(const string& text) {
+        IROperand o = IROperand::make(IRO_CONST, static_cast<uint32_t>(consts.size()));
+        consts.push_back(copyString(text));
+        return o;
+    }
 
-                            cout << "[DEBUG] Using production " << id << ": " << x << " -> ";
-                            for (size_t i = 0; i < tmp.size(); ++i) {
-                                cout << tmp[i] << " ";
-                            }
-                            cout << endl;
+    static const uint16_t RAW_OVERFLOW = 0xFFFF;    // ԭıʱ IR_RAW  aux
 
-                            if (!(tmp.size() == 1 && tmp[0] == "$")) {
-                                // ѹջ
-                                for (int i = static_cast<int>(tmp.size()) - 1; i >= 0; --i) {
-                                    SYN.push_back(tmp[i]);
-                                }
-                            }
-                        }
-                        else {
-                            cout << "[ERROR] Invalid production id: " << id << endl;
-                        }
-                    }
-                    else {
-                        cout << "[ERROR] No entry in analysis table for " << x << " with " << w << endl;
-                    }
-                }
-                else {
-                    cout << "[ERROR] Expected " << x << " but got " << w << endl;
-                }
-            }
-            else {
-                // ƥɹ
-                cout << "[DEBUG] Matched: " << x << " with token: " << token.val << endl;
+    // δ֪ԭ rawOps е±꣨ͬԭĹһ aux ıʾΧʱ
+    //  RAW_OVERFLOWӳ䵽ԭ
+    uint16_t rawOpcode(const string& text) {
+        for (size_t i = 0; i < rawOps.size(); ++i) {
+            if (text == rawOps[i]) return static_cast<uint16_t>(i);
+        }
+        if (rawOps.size() >= RAW_OVERFLOW) {
+            cout << "[ERROR] Too many distinct unknown operators in function " << name << ": " << text << endl;
+            return RAW_OVERFLOW;
+        }
+        rawOps.push_back(copyString(text));
+        return static_cast<uint16_t>(rawOps.size() - 1);
+    }
 
-                // ƥtokenӵջ
-                MATCHED_TOKENS.push_back(token);
+    // ָԱ±ʱе֣
+    void clearCode() {
+        code.clear();
+        blockStarts.clear();
+    }
 
-                if (w == "#") {
-                    cout << "[DEBUG] Analysis completed" << endl;
-                    break;
-                }
+    // ԪʽеĲıΪIROperandṹ޷ʶʱԭΪű
+    IROperand operand(const string& text) {
+        IROperand o = parseOperand(text);
+        if (o.kind() != IRO_SYM && operandText(o) != text) {
+            return symbol(text);
+        }
+        return o;
+    }
 
-                if (tokenIndex < TokenList.size()) {
-                    token = TokenList[tokenIndex++];
-                    w = getTokenVal(token);
-                }
-                else {
-                    w = "#";
-                }
-            }
+    string operandText(IROperand o) const {
+        stringstream ss;
+        switch (o.kind()) {
+        case IRO_NONE:
+            return "_";
+        case IRO_TEMP:
+            ss << "@t" << o.index();
+            return ss.str();
+        case IRO_SYM:
+            return names[o.index()];
+        case IRO_IMM:
+            ss << o.immValue();
+            return ss.str();
+        case IRO_CONST:
+            return consts[o.index()];
+        case IRO_LABEL:
+            ss << "L" << o.index();
+            return ss.str();
+        case IRO_REF: {
+            const IRRef& ref = refs[o.index()];
+            string text = names[ref.base];
+            if (!ref.index.isNone()) {
+                text += "[" + operandText(ref.index) + "]";
+            }
+            if (ref.member != IR_NO_MEMBER) {
+                text += ".";
+                text += names[ref.member];
+            }
+            return text;
+        }
+        }
+        return "_";
+    }
+
+    string opcodeText(const IRInst& inst) const {
+        if (inst.opcode() == IR_BR) {
+            return string(IR_OPCODE_NAMES[inst.flags]) + IR_OPCODE_NAMES[inst.aux];
+        }
+        if (inst.opcode() == IR_RAW) {
+            return inst.aux < rawOps.size() ? rawOps[inst.aux] : "<unknown operator>";
         }
+        return IR_OPCODE_NAMES[inst.op];
+    }
 
-        qt_res.push_back(qtList);
-        cout << "[DEBUG] Generated " << qtList.size() << " quaternions" << endl;
+    // ʵռõֽ vector ǰȼƣֲַұڵArena
+    size_t byteSize() const {
+        return code.size() * sizeof(IRInst) + blockStarts.size() * sizeof(uint32_t) +
+            (names.size() + consts.size() + rawOps.size()) * sizeof(const char*) + refs.size() * sizeof(IRRef) +
+            arena.usedBytes();
     }
 
-    // ӡԪʽ
-    void printQuaternions() {
-        cout << "\n=== Quaternions ===" << endl;
-        for (size_t i = 0; i < qt_res.size(); ++i) {
-            cout << "Function " << i << ":" << endl;
-            for (size_t j = 0; j < qt_res[i].size(); ++j) {
-                const Quaternion& q = qt_res[i][j];
-                cout << "  [" << j << "] (" << q.op << ", "
-                    << q.arg1 << ", " << q.arg2 << ", "
-                    << q.result << ")" << endl;
+    // õʱ+1ʱ￪ʼ
+    uint32_t tempCount() const {
+        uint32_t count = 0;
+        for (size_t i = 0; i < code.size(); ++i) {
+            const IROperand ops[3] = { code[i].a, code[i].b, code[i].r };
+            for (int k = 0; k < 3; ++k) {
+                if (ops[k].kind() == IRO_TEMP) count = max(count, ops[k].index() + 1);
             }
         }
+        for (size_t i = 0; i < refs.size(); ++i) {
+            if (refs[i].index.kind() == IRO_TEMP) count = max(count, refs[i].index.index() + 1);
+        }
+        return count;
     }
 
 private:
-    // ȡTokenֵ﷨
-    string getTokenVal(const Token& token) {
-        // Ƿǽṹ
-        if (find(syn_table->structNameList.begin(),
-            syn_table->structNameList.end(),
-            token.val) != syn_table->structNameList.end()) {
-            return "st";
-        }
+    IRNameIds nameIds;
 
-        if (token.type == "con") {
-            return "NUM";
-        }
+    IRFunction(const IRFunction&);
+    IRFunction& operator=(const IRFunction&);
 
-        if (token.type == "i") {
+    const char* copyString(const string& text) {
+        char* p = static_cast<char*>(arena.allocate(text.size() + 1, 1));
+        memcpy(p, text.c_str(), text.size() + 1);
+        return p;
+    }
+
+    IROperand parseOperand(const string& text) {
+        if (text.empty() || text == "_") {
+            return IROperand();
+        }
+
+        if (text.size() > 2 && text[0] == '@' && text[1] == 't' && isDigits(text, 2)) {
+            return IROperand::make(IRO_TEMP, static_cast<uint32_t>(atol(text.c_str() + 2)));
+        }
+
+        size_t start = (text[0] == '-' || text[0] == '+') ? 1 : 0;
+        if (start < text.size() && isdigit(static_cast<unsigned char>(text[start]))) {
+            if (isDigits(text, start) && text.size() - start < 10) {
+                long value = atol(text.c_str());
+                if (IROperand::fitsImm(value)) {
+                    return IROperand::imm(static_cast<int>(value));
+                }
+            }
+            return constant(text);
+        }
+
+        size_t bracketPos = text.find('[');
+        size_t dotPos = text.find('.');
+        if (bracketPos != string::npos && text[text.size() - 1] == ']' &&
+            bracketPos > 0 && (dotPos == string::npos || dotPos > bracketPos)) {
+            IRRef ref;
+            ref.base = symbol(text.substr(0, bracketPos)).index();
+            ref.index = operand(text.substr(bracketPos + 1, text.size() - bracketPos - 2));
+            ref.member = IR_NO_MEMBER;
+            return addRef(ref);
+        }
+        if (dotPos != string::npos && bracketPos == string::npos && dotPos > 0 &&
+            text.find('.', dotPos + 1) == string::npos) {
+            IRRef ref;
+            ref.base = symbol(text.substr(0, dotPos)).index();
+            ref.member = symbol(text.substr(dotPos + 1)).index();
+            return addRef(ref);
+        }
+
+        return symbol(text);
+    }
+
+    IROperand addRef(const IRRef& ref) {
+        IROperand o = IROperand::make(IRO_REF, static_cast<uint32_t>(refs.size()));
+        refs.push_back(ref);
+        return o;
+    }
+
+    static bool isDigits(const string& text, size_t from) {
+        if (from >= text.size()) return false;
+        for (size_t i = from; i < text.size(); ++i) {
+            if (!isdigit(static_cast<unsigned char>(text[i]))) return false;
+        }
+        return true;
+    }
+};
+
+// ַԪʽIR֮
+class IRAdapter {
+public:
+    static IROpcode opcodeOf(const string& op) {
+        for (int i = IR_FUN; i < IR_RAW; ++i) {
+            if (op == IR_OPCODE_NAMES[i]) {
+                return static_cast<IROpcode>(i);
+            }
+        }
+        return IR_RAW;
+    }
+
+    // ںϵıȽתд +ȽϷif<elif==do>= ȣΪ L<ָ±>
+    static bool splitBranch(const string& op, IROpcode& marker, IROpcode& cmp) {
+        static const IROpcode markers[3] = { IR_IF, IR_ELIF, IR_DO };
+        for (int m = 0; m < 3; ++m) {
+            size_t len = strlen(IR_OPCODE_NAMES[markers[m]]);
+            if (op.size() <= len || op.compare(0, len, IR_OPCODE_NAMES[markers[m]]) != 0) continue;
+            IROpcode c = opcodeOf(op.substr(len));
+            if (c >= IR_GT && c <= IR_NE) {
+                marker = markers[m];
+                cmp = c;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static IRInst encode(IRFunction& fn, const Quaternion& q) {
+        IROpcode marker, cmp;
+        if (splitBranch(q.op, marker, cmp) && q.result.size() > 1 && q.result[0] == 'L') {
+            IRInst inst(IR_BR, fn.operand(q.arg1), fn.operand(q.arg2),
+                IROperand::make(IRO_LABEL, static_cast<uint32_t>(atol(q.result.c_str() + 1))));
+            inst.flags = static_cast<uint8_t>(marker);
+            inst.aux = static_cast<uint16_t>(cmp);
+            return inst;
+        }
+        IROpcode op = opcodeOf(q.op);
+        IRInst inst(op, fn.operand(q.arg1), fn.operand(q.arg2), fn.operand(q.result));
+        if (op == IR_RAW) {
+            inst.aux = fn.rawOpcode(q.op);
+        }
+        return inst;
+    }
+
+    static Quaternion decode(const IRFunction& fn, const IRInst& inst) {
+        return Quaternion(fn.opcodeText(inst), fn.operandText(inst.a),
+            fn.operandText(inst.b), fn.operandText(inst.r));
+    }
+
+    // QtGen һص IRFunction ɵ߸ͷ
+    static IRFunction* fromQuaternions(const vector<Quaternion>& qts) {
+        IRFunction* fn = new IRFunction();
+        fn->code.reserve(qts.size());
+        for (size_t i = 0; i < qts.size(); ++i) {
+            fn->code.push_back(encode(*fn, qts[i]));
+        }
+        if (!qts.empty() && qts[0].op == "FUN") {
+            fn->name = qts[0].arg1;
+        }
+        return fn;
+    }
+
+    // Optimization İ黮ֵĴ룬滻ԭеָ
+    static void assignBlocks(IRFunction& fn, const vector<vector<Quaternion> >& blocks) {
+        size_t total = 0;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            total += blocks[i].size();
+        }
+
+        fn.clearCode();
+        fn.code.reserve(total);
+        fn.blockStarts.reserve(blocks.size());
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            fn.blockStarts.push_back(static_cast<uint32_t>(fn.code.size()));
+            for (size_t j = 0; j < blocks[i].size(); ++j) {
+                fn.code.push_back(encode(fn, blocks[i][j]));
+            }
+        }
+    }
+
+    // ɽһͷIR
+    static void release(vector<IRFunction*>& functions) {
+        for (size_t i = 0; i < functions.size(); ++i) {
+            delete functions[i];
+        }
+        functions.clear();
+    }
+
+    static vector<Quaternion> toQuaternions(const IRFunction& fn) {
+        vector<Quaternion> qts;
+        qts.reserve(fn.code.size());
+        for (size_t i = 0; i < fn.code.size(); ++i) {
+            qts.push_back(decode(fn, fn.code[i]));
+        }
+        return qts;
+    }
+
+    //  AsmCodeGen ʹãδֻʱΪһ
+    static vector<vector<Quaternion> > toBlocks(const IRFunction& fn) {
+        vector<vector<Quaternion> > blocks;
+        if (fn.blockStarts.empty()) {
+            blocks.push_back(toQuaternions(fn));
+            return blocks;
+        }
+        for (size_t i = 0; i < fn.blockStarts.size(); ++i) {
+            size_t end = i + 1 < fn.blockStarts.size() ? fn.blockStarts[i + 1] : fn.code.size();
+            vector<Quaternion> bloc;
+            for (size_t j = fn.blockStarts[i]; j < end; ++j) {
+                bloc.push_back(decode(fn, fn.code[j]));
+            }
+            blocks.push_back(bloc);
+        }
+        return blocks;
+    }
+};
+
+// ============================================================================
+// IRFile - ÿŻIRĶƻ
+// ļ֣ȫΪ4ֽڶС˼¼ SymbolFile ͬķʽӳȡ
+//   IRFileHeader
+//   uint32 stringOffsets[stringCount]
+//   IRFileFunction functions[functionCount]
+//   uint32 tableStrings[tableCount]          // ֱַ±
+//   IRRef refs[refCount]
+//   IRInst code[instCount]                   // ڴе16ָֽȫͬ
+//   uint32 blockStarts[blockCount]
+//   char strings[stringBytes]
+// ÿ¼ԴtokenеɢУԴδĺֱ·Ż
+// ============================================================================
+struct IRFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t stringCount;
+    uint32_t stringBytes;
+    uint32_t functionCount;
+    uint32_t tableCount;
+    uint32_t refCount;
+    uint32_t instCount;
+    uint32_t blockCount;
+};
+
+struct IRFileFunction {
+    uint32_t name;
+    uint32_t hashLow;           // Դtokenɢ
+    uint32_t hashHigh;
+    uint32_t firstName;         // tableStrings еλ
+    uint32_t nameCount;
+    uint32_t constCount;        // ֮
+    uint32_t firstRef;
+    uint32_t refCount;
+    uint32_t firstInst;
+    uint32_t instCount;
+    uint32_t firstBlock;
+    uint32_t blockCount;
+    uint32_t originalCount;     // Żǰָͳã
+    uint32_t rawOpCount;        // IR_RAW ԭģڳ֮
+};
+
+static_assert(sizeof(IRRef) == 12, "IRRef is written to IR files as-is");
+
+class IRFile {
+public:
+    static const uint32_t MAGIC = 0x31525149;   // "IQR1"
+    static const uint32_t VERSION = 4;    // 2ںϱȽת IR_BR3¼ originalCount4IR_RAW ԭĵɱ
+
+    IRFile() : hdr(NULL), stringOffsets(NULL), functions(NULL), tableStrings(NULL),
+        refs(NULL), code(NULL), blockStarts(NULL), strings(NULL) {}
+
+    // Դtoken64λFNV-1aɢУcontext Ӱ췭ȫϢṹȣ
+    static uint64_t hashTokens(const vector<Token>& tokens, const string& context) {
+        uint64_t h = 14695981039346656037ULL;
+        hashString(h, context);
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            hashString(h, tokens[i].type);
+            hashString(h, tokens[i].val);
+        }
+        return h;
+    }
+
+    // ĺеĵãÿõһǿеһtoken
+    static void scanCalls(const vector<vector<Token> >& blocks, const set<string>& functionNames,
+        vector<string>& owners, vector<vector<string> >& calls) {
+        owners.assign(blocks.size(), string());
+        calls.assign(blocks.size(), vector<string>());
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            bool named = false;
+            for (size_t k = 0; k < blocks[i].size(); ++k) {
+                const string& val = blocks[i][k].val;
+                if (!functionNames.count(val)) continue;
+                if (!named) owners[i] = val;
+                else calls[i].push_back(val);
+                named = true;
+            }
+        }
+    }
+
+    // ÿֱӻӵõĺ
+    static vector<set<int> > reachableCallees(const vector<string>& owners, const vector<vector<string> >& calls) {
+        map<string, int> owner;
+        for (size_t i = 0; i < owners.size(); ++i) {
+            if (!owners[i].empty() && !owner.count(owners[i])) owner[owners[i]] = static_cast<int>(i);
+        }
+
+        vector<set<int> > reached(owners.size());
+        for (size_t i = 0; i < owners.size(); ++i) {
+            vector<int> work(1, static_cast<int>(i));
+            while (!work.empty()) {
+                int f = work.back();
+                work.pop_back();
+                for (size_t k = 0; k < calls[f].size(); ++k) {
+                    map<string, int>::const_iterator it = owner.find(calls[f][k]);
+                    if (it != owner.end() && it->second != static_cast<int>(i) && reached[i].insert(it->second).second) {
+                        work.push_back(it->second);
+                    }
+                }
+            }
+        }
+        return reached;
+    }
+
+    // ʹIRֱӻӵõĺЩɢҲ룬
+    // κһı䶼ʹߵĻʧЧǷȡڱ
+    // еĵõһ
+    static void mixCallees(vector<uint64_t>& hashes, const vector<vector<Token> >& blocks,
+        const set<string>& functionNames) {
+        vector<string> owners;
+        vector<vector<string> > calls;
+        scanCalls(blocks, functionNames, owners, calls);
+        vector<set<int> > reached = reachableCallees(owners, calls);
+        map<string, uint64_t> callSites;
+        for (size_t i = 0; i < calls.size(); ++i) {
+            for (size_t k = 0; k < calls[i].size(); ++k) callSites[calls[i][k]]++;
+        }
+
+        vector<uint64_t> base(hashes);
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            for (set<int>::const_iterator it = reached[i].begin(); it != reached[i].end(); ++it) {
+                uint64_t words[2] = { base[*it], callSites[owners[*it]] };
+                for (int w = 0; w < 2; ++w) {
+                    for (int b = 0; b < 8; ++b) {
+                        hashes[i] = (hashes[i] ^ ((words[w] >> (8 * b)) & 0xFFu)) * 1099511628211ULL;
+                    }
+                }
+            }
+        }
+    }
+
+    // originalCountsŻǰָʱ originalCount ȡ
+    static bool write(const string& path, const vector<IRFunction*>& functionIR, const vector<uint64_t>& hashes,
+        const vector<int>& originalCounts) {
+        cout << "[DEBUG] IRFile::write - Writing IR file: " << path << endl;
+
+        vector<string> stringList;
+        map<string, uint32_t> stringIds;
+        vector<IRFileFunction> functionRecords;
+        vector<uint32_t> tableRecords;
+        vector<IRRef> refRecords;
+        vector<IRInst> codeRecords;
+        vector<uint32_t> blockRecords;
+
+        for (size_t i = 0; i < functionIR.size(); ++i) {
+            const IRFunction& fn = *functionIR[i];
+            IRFileFunction rec;
+            rec.name = intern(fn.name, stringList, stringIds);
+            rec.hashLow = static_cast<uint32_t>(hashes[i]);
+            rec.hashHigh = static_cast<uint32_t>(hashes[i] >> 32);
+            rec.firstName = static_cast<uint32_t>(tableRecords.size());
+            rec.nameCount = static_cast<uint32_t>(fn.names.size());
+            rec.constCount = static_cast<uint32_t>(fn.consts.size());
+            for (size_t j = 0; j < fn.names.size(); ++j) {
+                tableRecords.push_back(intern(fn.names[j], stringList, stringIds));
+            }
+            for (size_t j = 0; j < fn.consts.size(); ++j) {
+                tableRecords.push_back(intern(fn.consts[j], stringList, stringIds));
+            }
+            rec.rawOpCount = static_cast<uint32_t>(fn.rawOps.size());
+            for (size_t j = 0; j < fn.rawOps.size(); ++j) {
+                tableRecords.push_back(intern(fn.rawOps[j], stringList, stringIds));
+            }
+            rec.firstRef = static_cast<uint32_t>(refRecords.size());
+            rec.refCount = static_cast<uint32_t>(fn.refs.size());
+            refRecords.insert(refRecords.end(), fn.refs.begin(), fn.refs.end());
+            rec.firstInst = static_cast<uint32_t>(codeRecords.size());
+            rec.instCount = static_cast<uint32_t>(fn.code.size());
+            codeRecords.insert(codeRecords.end(), fn.code.begin(), fn.code.end());
+            rec.firstBlock = static_cast<uint32_t>(blockRecords.size());
+            rec.blockCount = static_cast<uint32_t>(fn.blockStarts.size());
+            rec.originalCount = static_cast<uint32_t>(originalCounts[i]);
+            blockRecords.insert(blockRecords.end(), fn.blockStarts.begin(), fn.blockStarts.end());
+            functionRecords.push_back(rec);
+        }
+
+        vector<uint32_t> stringOffsetList;
+        string stringBytes;
+        for (size_t i = 0; i < stringList.size(); ++i) {
+            stringOffsetList.push_back(static_cast<uint32_t>(stringBytes.size()));
+            stringBytes += stringList[i];
+            stringBytes += '\0';
+        }
+
+        IRFileHeader header;
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.stringCount = static_cast<uint32_t>(stringList.size());
+        header.stringBytes = static_cast<uint32_t>(stringBytes.size());
+        header.functionCount = static_cast<uint32_t>(functionRecords.size());
+        header.tableCount = static_cast<uint32_t>(tableRecords.size());
+        header.refCount = static_cast<uint32_t>(refRecords.size());
+        header.instCount = static_cast<uint32_t>(codeRecords.size());
+        header.blockCount = static_cast<uint32_t>(blockRecords.size());
+
+        ofstream out(path.c_str(), ios::out | ios::binary | ios::trunc);
+        if (!out.is_open()) {
+            cout << "[ERROR] Could not create IR file: " << path << endl;
+            return false;
+        }
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeArray(out, stringOffsetList);
+        writeArray(out, functionRecords);
+        writeArray(out, tableRecords);
+        writeArray(out, refRecords);
+        writeArray(out, codeRecords);
+        writeArray(out, blockRecords);
+        out.write(stringBytes.data(), stringBytes.size());
+        out.close();
+
+        cout << "[DEBUG] IR file written: " << functionRecords.size() << " functions, "
+            << codeRecords.size() << " instructions" << endl;
+        return true;
+    }
+
+    bool open(const string& path) {
+        cout << "[DEBUG] IRFile::open - Mapping IR file: " << path << endl;
+        close();
+
+        if (!file.open(path)) {
+            cout << "[DEBUG] No IR file at: " << path << endl;
+            return false;
+        }
+        if (!validate()) {
+            cout << "[ERROR] Invalid IR file: " << path << endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        file.close();
+        hdr = NULL;
+    }
+
+    bool isOpen() const {
+        return hdr != NULL;
+    }
+
+    // ԴɢвҺδҵ-1
+    int findFunction(uint64_t hash) const {
+        if (!hdr) return -1;
+        for (uint32_t i = 0; i < hdr->functionCount; ++i) {
+            if (functions[i].hashLow == static_cast<uint32_t>(hash) &&
+                functions[i].hashHigh == static_cast<uint32_t>(hash >> 32)) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    // һص IRFunction ɵͷţ¼ݲһʱ NULL
+    IRFunction* load(int f) const {
+        const IRFileFunction& rec = functions[f];
+        IRFunction* fn = new IRFunction();
+        fn->name = getString(rec.name);
+
+        for (uint32_t i = 0; i < rec.nameCount; ++i) {
+            if (fn->symbol(getString(tableStrings[rec.firstName + i])).index() != i) {
+                delete fn;      // ظ write ɵ
+                return NULL;
+            }
+        }
+        for (uint32_t i = 0; i < rec.constCount; ++i) {
+            fn->constant(getString(tableStrings[rec.firstName + rec.nameCount + i]));
+        }
+        for (uint32_t i = 0; i < rec.rawOpCount; ++i) {
+            if (fn->rawOpcode(getString(tableStrings[rec.firstName + rec.nameCount + rec.constCount + i])) != i) {
+                delete fn;      // ԭظ࣬ write ɵ
+                return NULL;
+            }
+        }
+        fn->refs.assign(refs + rec.firstRef, refs + rec.firstRef + rec.refCount);
+        fn->code.assign(code + rec.firstInst, code + rec.firstInst + rec.instCount);
+        fn->blockStarts.assign(blockStarts + rec.firstBlock, blockStarts + rec.firstBlock + rec.blockCount);
+
+        if (!checkOperands(*fn)) {
+            delete fn;
+            return NULL;
+        }
+        return fn;
+    }
+
+    const char* getString(uint32_t id) const {
+        return strings + stringOffsets[id];
+    }
+
+    int originalCount(int f) const {
+        return static_cast<int>(functions[f].originalCount);
+    }
+
+private:
+    MappedFile file;
+    const IRFileHeader* hdr;
+    const uint32_t* stringOffsets;
+    const IRFileFunction* functions;
+    const uint32_t* tableStrings;
+    const IRRef* refs;
+    const IRInst* code;
+    const uint32_t* blockStarts;
+    const char* strings;
+
+    IRFile(const IRFile&);
+    IRFile& operator=(const IRFile&);
+
+    static void hashString(uint64_t& h, const string& s) {
+        for (size_t i = 0; i < s.size(); ++i) {
+            h = (h ^ static_cast<unsigned char>(s[i])) * 1099511628211ULL;
+        }
+        h = (h ^ 0xFFu) * 1099511628211ULL;     // ָ "ab"+"c"  "a"+"bc" ͬ
+    }
+
+    static uint32_t intern(const string& s, vector<string>& stringList, map<string, uint32_t>& stringIds) {
+        map<string, uint32_t>::iterator it = stringIds.find(s);
+        if (it != stringIds.end()) {
+            return it->second;
+        }
+        uint32_t id = static_cast<uint32_t>(stringList.size());
+        stringList.push_back(s);
+        stringIds[s] = id;
+        return id;
+    }
+
+    template <typename T>
+    static void writeArray(ofstream& out, const vector<T>& items) {
+        if (!items.empty()) {
+            out.write(reinterpret_cast<const char*>(&items[0]), items.size() * sizeof(T));
+        }
+    }
+
+    static bool validOperand(const IRFunction& fn, IROperand o) {
+        switch (o.kind()) {
+        case IRO_NONE: return o.isNone();
+        case IRO_SYM: return o.index() < fn.names.size();
+        case IRO_CONST: return o.index() < fn.consts.size();
+        case IRO_REF: return o.index() < fn.refs.size();
+        case IRO_TEMP: case IRO_IMM: case IRO_LABEL: return true;
+        }
+        return false;
+    }
+
+    // ָе±궼ڱı
+    static bool checkOperands(const IRFunction& fn) {
+        for (size_t i = 0; i < fn.refs.size(); ++i) {
+            const IRRef& ref = fn.refs[i];
+            if (ref.base >= fn.names.size()) return false;
+            if (ref.member != IR_NO_MEMBER && ref.member >= fn.names.size()) return false;
+            if (ref.index.kind() == IRO_REF || !validOperand(fn, ref.index)) return false;
+        }
+        for (size_t i = 0; i < fn.code.size(); ++i) {
+            const IRInst& inst = fn.code[i];
+            if (inst.op >= IR_OPCODE_COUNT) return false;
+            if (inst.opcode() == IR_RAW && inst.aux >= fn.rawOps.size()) return false;
+            if (inst.opcode() == IR_BR && (inst.aux < IR_GT || inst.aux > IR_NE ||
+                (inst.flags != IR_IF && inst.flags != IR_ELIF && inst.flags != IR_DO) ||
+                inst.r.kind() != IRO_LABEL || inst.r.index() > fn.code.size())) return false;
+            if (!validOperand(fn, inst.a) || !validOperand(fn, inst.b) || !validOperand(fn, inst.r)) return false;
+        }
+        for (size_t i = 0; i < fn.blockStarts.size(); ++i) {
+            if (fn.blockStarts[i] > fn.code.size()) return false;
+        }
+        return true;
+    }
+
+    bool validate() {
+        const char* base = file.data();
+        size_t length = file.size();
+        if (length < sizeof(IRFileHeader)) return false;
+        const IRFileHeader* h = reinterpret_cast<const IRFileHeader*>(base);
+        if (h->magic != MAGIC || h->version != VERSION) return false;
+
+        size_t offset = sizeof(IRFileHeader);
+        size_t need = offset
+            + static_cast<size_t>(h->stringCount) * sizeof(uint32_t)
+            + static_cast<size_t>(h->functionCount) * sizeof(IRFileFunction)
+            + static_cast<size_t>(h->tableCount) * sizeof(uint32_t)
+            + static_cast<size_t>(h->refCount) * sizeof(IRRef)
+            + static_cast<size_t>(h->instCount) * sizeof(IRInst)
+            + static_cast<size_t>(h->blockCount) * sizeof(uint32_t)
+            + h->stringBytes;
+        if (need != length) return false;
+
+        stringOffsets = reinterpret_cast<const uint32_t*>(base + offset);
+        offset += h->stringCount * sizeof(uint32_t);
+        functions = reinterpret_cast<const IRFileFunction*>(base + offset);
+        offset += h->functionCount * sizeof(IRFileFunction);
+        tableStrings = reinterpret_cast<const uint32_t*>(base + offset);
+        offset += h->tableCount * sizeof(uint32_t);
+        refs = reinterpret_cast<const IRRef*>(base + offset);
+        offset += h->refCount * sizeof(IRRef);
+        code = reinterpret_cast<const IRInst*>(base + offset);
+        offset += h->instCount * sizeof(IRInst);
+        blockStarts = reinterpret_cast<const uint32_t*>(base + offset);
+        offset += h->blockCount * sizeof(uint32_t);
+        strings = base + offset;
+
+        if (h->stringBytes > 0 && strings[h->stringBytes - 1] != '\0') return false;
+        for (uint32_t i = 0; i < h->stringCount; ++i) {
+            if (stringOffsets[i] >= h->stringBytes) return false;
+        }
+        for (uint32_t i = 0; i < h->tableCount; ++i) {
+            if (tableStrings[i] >= h->stringCount) return false;
+        }
+        for (uint32_t i = 0; i < h->functionCount; ++i) {
+            const IRFileFunction& f = functions[i];
+            if (f.name >= h->stringCount) return false;
+            if (static_cast<uint64_t>(f.firstName) + f.nameCount + f.constCount + f.rawOpCount > h->tableCount) return false;
+            if (static_cast<uint64_t>(f.firstRef) + f.refCount > h->refCount) return false;
+            if (static_cast<uint64_t>(f.firstInst) + f.instCount > h->instCount) return false;
+            if (static_cast<uint64_t>(f.firstBlock) + f.blockCount > h->blockCount) return false;
+        }
+
+        hdr = h;
+        return true;
+    }
+};
+
+// ============================================================================
+// ͼ
+// ɺIRеĽṹǣif/elif/el/iewh/do/webreak/continue/return
+// ʽ鼰ǰ/̱ߣ֧ѭǶס
+// 黮 Optimization ԭйһ£wh ʼ¿飬ǽǰ飬
+// FUN ɿ顣ÿһΣŻʹɹá
+// ============================================================================
+struct CFGBlock {
+    int first;              // һָ±
+    int last;               // һָ±֮
+    vector<int> succs;      // ̿飻תʱ succs[0] Ϊķ֧
+    vector<int> preds;      // ǰ
+    int idom;               // ֱ֧ߣڿͲɴΪ -1
+    int loop;               // ڲѭ-1 ʾѭ
+    int loopDepth;          // ѭǶ
+
+    CFGBlock(int f, int l) : first(f), last(l), idom(-1), loop(-1), loopDepth(0) {}
+};
+
+struct CFGLoop {
+    int header;             // ѭͷ wh ʼĿ飩
+    int parent;             // ѭ-1 ʾ
+    int depth;              // ǶȣΪ1
+    vector<int> blocks;     // ѭеĿ飨ѭͷ
+    vector<int> latches;    // رߵ
+};
+
+class ControlFlowGraph {
+public:
+    vector<CFGBlock> blocks;
+    vector<CFGLoop> loops;
+    vector<int> rpo;        // ڿɴĿ
+
+    explicit ControlFlowGraph(const IRFunction& fn) {
+        buildBlocks(fn);
+        buildEdges(fn);
+        computeOrder();
+        computeDominators();
+        findLoops();
+    }
+
+    int entry() const { return 0; }
+
+    bool reachable(int b) const {
+        return b == entry() || blocks[b].idom >= 0;
+    }
+
+    // a Ƿ֧ bɴĿ鲻κο֧䣩
+    bool dominates(int a, int b) const {
+        if (!reachable(b)) return false;
+        while (b != a && b != entry()) {
+            b = blocks[b].idom;
+        }
+        return b == a;
+    }
+
+    // ֧ÿӽڵ
+    vector<vector<int> > dominatorChildren() const {
+        vector<vector<int> > children(blocks.size());
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            if (blocks[b].idom >= 0) {
+                children[blocks[b].idom].push_back(static_cast<int>(b));
+            }
+        }
+        return children;
+    }
+
+    // ֧߽磨ֻǿɴ飩
+    vector<vector<int> > dominanceFrontiers() const {
+        vector<vector<int> > df(blocks.size());
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            if (!reachable(static_cast<int>(b)) || blocks[b].preds.size() < 2) continue;
+            for (size_t i = 0; i < blocks[b].preds.size(); ++i) {
+                int runner = blocks[b].preds[i];
+                if (!reachable(runner)) continue;
+                while (runner != blocks[b].idom && runner >= 0) {
+                    if (find(df[runner].begin(), df[runner].end(), static_cast<int>(b)) == df[runner].end()) {
+                        df[runner].push_back(static_cast<int>(b));
+                    }
+                    runner = blocks[runner].idom;
+                }
+            }
+        }
+        return df;
+    }
+
+    // ıǣתλãָ˳ִ
+    static bool endsBlock(IROpcode op) {
+        return op == IR_DO || op == IR_WE || op == IR_IF || op == IR_EL ||
+            op == IR_ELIF || op == IR_IE || op == IR_RETURN ||
+            op == IR_CONTINUE || op == IR_BREAK;
+    }
+
+    void print(ostream& out) const {
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            const CFGBlock& b = blocks[i];
+            out << "  B" << i << " [" << b.first << ".." << b.last - 1 << "]";
+            out << " succ:";
+            printList(out, b.succs);
+            out << " pred:";
+            printList(out, b.preds);
+            out << " idom: ";
+            if (b.idom >= 0) out << "B" << b.idom; else out << "-";
+            out << " loop depth: " << b.loopDepth;
+            if (!reachable(static_cast<int>(i))) out << " (unreachable)";
+            out << endl;
+        }
+        for (size_t i = 0; i < loops.size(); ++i) {
+            const CFGLoop& l = loops[i];
+            out << "  Loop " << i << ": header B" << l.header << ", depth " << l.depth << ", blocks";
+            printList(out, l.blocks);
+            out << endl;
+        }
+    }
+
+private:
+    static void printList(ostream& out, const vector<int>& list) {
+        if (list.empty()) {
+            out << " -";
+        }
+        for (size_t i = 0; i < list.size(); ++i) {
+            out << " B" << list[i];
+        }
+    }
+
+    void buildBlocks(const IRFunction& fn) {
+        int n = static_cast<int>(fn.code.size());
+        int start = 0;
+        for (int i = 0; i < n; ++i) {
+            IROpcode op = fn.code[i].marker();
+            if ((op == IR_WH || op == IR_FUN) && i > start) {
+                blocks.push_back(CFGBlock(start, i));
+                start = i;
+            }
+            if (endsBlock(op) || op == IR_FUN) {
+                blocks.push_back(CFGBlock(start, i + 1));
+                start = i + 1;
+            }
+        }
+        if (start < n || blocks.empty()) {
+            blocks.push_back(CFGBlock(start, n));
+        }
+    }
+
+    void addEdge(int from, int to) {
+        if (to < 0 || to >= static_cast<int>(blocks.size())) return;
+        blocks[from].succs.push_back(to);
+        blocks[to].preds.push_back(from);
+    }
+
+    // ǵǶ׹ϵߣelbreak תĿҪȵӦ iewe ȷ
+    void buildEdges(const IRFunction& fn) {
+        struct IfFrame {
+            int pendingFalse;       // ȴһ el 
+            vector<int> toEnd;      //  el β ie ֮Ŀ
+        };
+        struct LoopFrame {
+            int header;
+            int cond;               //  do βĿ飬ʱѭ
+            vector<int> breaks;
+        };
+        vector<IfFrame> ifs;
+        vector<LoopFrame> whiles;
+
+        int count = static_cast<int>(blocks.size());
+        for (int b = 0; b < count; ++b) {
+            const CFGBlock& blk = blocks[b];
+            int next = b + 1;
+
+            if (blk.first < blk.last && fn.code[blk.first].opcode() == IR_WH) {
+                LoopFrame lf;
+                lf.header = b;
+                lf.cond = -1;
+                whiles.push_back(lf);
+            }
+
+            IROpcode op = blk.first < blk.last ? fn.code[blk.last - 1].marker() : IR_NOP;
+            switch (op) {
+            case IR_IF: {
+                IfFrame f;
+                f.pendingFalse = b;
+                ifs.push_back(f);
+                addEdge(b, next);
+                break;
+            }
+            case IR_ELIF:
+                addEdge(b, next);
+                if (!ifs.empty()) ifs.back().pendingFalse = b;
+                break;
+            case IR_EL:
+                if (!ifs.empty()) {
+                    ifs.back().toEnd.push_back(b);
+                    if (ifs.back().pendingFalse >= 0) {
+                        addEdge(ifs.back().pendingFalse, next);
+                        ifs.back().pendingFalse = -1;
+                    }
+                }
+                break;
+            case IR_IE:
+                addEdge(b, next);
+                if (!ifs.empty()) {
+                    if (ifs.back().pendingFalse >= 0) {
+                        addEdge(ifs.back().pendingFalse, next);
+                    }
+                    for (size_t i = 0; i < ifs.back().toEnd.size(); ++i) {
+                        addEdge(ifs.back().toEnd[i], next);
+                    }
+                    ifs.pop_back();
+                }
+                break;
+            case IR_DO:
+                addEdge(b, next);
+                if (!whiles.empty()) whiles.back().cond = b;
+                break;
+            case IR_WE:
+                if (!whiles.empty()) {
+                    addEdge(b, whiles.back().header);
+                    if (whiles.back().cond >= 0) {
+                        addEdge(whiles.back().cond, next);
+                    }
+                    for (size_t i = 0; i < whiles.back().breaks.size(); ++i) {
+                        addEdge(whiles.back().breaks[i], next);
+                    }
+                    whiles.pop_back();
+                }
+                break;
+            case IR_BREAK:
+                if (!whiles.empty()) whiles.back().breaks.push_back(b);
+                break;
+            case IR_CONTINUE:
+                if (!whiles.empty()) addEdge(b, whiles.back().header);
+                break;
+            case IR_RETURN:
+                break;
+            default:
+                addEdge(b, next);
+                break;
+            }
+        }
+    }
+
+    void computeOrder() {
+        vector<bool> visited(blocks.size(), false);
+        vector<pair<int, size_t> > stack;    // (, һҪʵĺ)
+        vector<int> post;
+        stack.push_back(make_pair(entry(), static_cast<size_t>(0)));
+        visited[entry()] = true;
+        while (!stack.empty()) {
+            int b = stack.back().first;
+            size_t& k = stack.back().second;
+            if (k < blocks[b].succs.size()) {
+                int s = blocks[b].succs[k++];
+                if (!visited[s]) {
+                    visited[s] = true;
+                    stack.push_back(make_pair(s, static_cast<size_t>(0)));
+                }
+            }
+            else {
+                post.push_back(b);
+                stack.pop_back();
+            }
+        }
+        rpo.assign(post.rbegin(), post.rend());
+    }
+
+    // Cooper-Harvey-Kennedy 㷨
+    void computeDominators() {
+        vector<int> order(blocks.size(), -1);
+        for (size_t i = 0; i < rpo.size(); ++i) {
+            order[rpo[i]] = static_cast<int>(i);
+        }
+
+        vector<int> idom(blocks.size(), -1);
+        idom[entry()] = entry();
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t i = 1; i < rpo.size(); ++i) {
+                int b = rpo[i];
+                int newIdom = -1;
+                for (size_t j = 0; j < blocks[b].preds.size(); ++j) {
+                    int p = blocks[b].preds[j];
+                    if (idom[p] < 0) continue;
+                    if (newIdom < 0) {
+                        newIdom = p;
+                        continue;
+                    }
+                    int x = p, y = newIdom;
+                    while (x != y) {
+                        while (order[x] > order[y]) x = idom[x];
+                        while (order[y] > order[x]) y = idom[y];
+                    }
+                    newIdom = x;
+                }
+                if (newIdom != idom[b]) {
+                    idom[b] = newIdom;
+                    changed = true;
+                }
+            }
+        }
+
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            blocks[b].idom = static_cast<int>(b) == entry() ? -1 : idom[b];
+        }
+    }
+
+    // ر latch -> headerheader ֧ latchȷȻѭ
+    void findLoops() {
+        map<int, int> loopOf;      // ѭͷ -> ѭ±
+        for (size_t i = 0; i < rpo.size(); ++i) {
+            int b = rpo[i];
+            for (size_t j = 0; j < blocks[b].succs.size(); ++j) {
+                int h = blocks[b].succs[j];
+                if (!dominates(h, b)) continue;
+
+                map<int, int>::iterator it = loopOf.find(h);
+                if (it == loopOf.end()) {
+                    CFGLoop l;
+                    l.header = h;
+                    l.parent = -1;
+                    l.depth = 0;
+                    l.blocks.push_back(h);
+                    loops.push_back(l);
+                    it = loopOf.insert(make_pair(h, static_cast<int>(loops.size()) - 1)).first;
+                }
+                CFGLoop& l = loops[it->second];
+                l.latches.push_back(b);
+
+                vector<int> work(1, b);
+                while (!work.empty()) {
+                    int x = work.back();
+                    work.pop_back();
+                    if (find(l.blocks.begin(), l.blocks.end(), x) != l.blocks.end()) continue;
+                    l.blocks.push_back(x);
+                    for (size_t k = 0; k < blocks[x].preds.size(); ++k) {
+                        if (reachable(blocks[x].preds[k])) work.push_back(blocks[x].preds[k]);
+                    }
+                }
+            }
+        }
+
+        // ѭǰѭͷСѭ
+        for (size_t i = 0; i < loops.size(); ++i) {
+            sort(loops[i].blocks.begin(), loops[i].blocks.end());
+        }
+        for (size_t i = 0; i < loops.size(); ++i) {
+            for (size_t j = 0; j < loops.size(); ++j) {
+                if (i == j || !binary_search(loops[j].blocks.begin(), loops[j].blocks.end(), loops[i].header)) continue;
+                if (loops[i].parent < 0 || loops[j].blocks.size() < loops[loops[i].parent].blocks.size()) {
+                    loops[i].parent = static_cast<int>(j);
+                }
+            }
+        }
+        for (size_t i = 0; i < loops.size(); ++i) {
+            int depth = 1;
+            for (int p = loops[i].parent; p >= 0; p = loops[p].parent) depth++;
+            loops[i].depth = depth;
+            for (size_t k = 0; k < loops[i].blocks.size(); ++k) {
+                CFGBlock& b = blocks[loops[i].blocks[k]];
+                if (depth > b.loopDepth) {
+                    b.loopDepth = depth;
+                    b.loop = static_cast<int>(i);
+                }
+            }
+        }
+    }
+};
+
+// ============================================================================
+// SSAʽ
+// ڿͼϰ֧߽phi@tʱû
+// ţx#1x#2 ...x#0 ʾڴֵ顢ṹԼ
+//  a[i]/s.x е԰ڴ洦
+// lower() SSA˻ͨԪʽ汾ӳԭıphi ǰĩβ
+// ɸֵĳҪİ汾ѱǡ̵ֵֻܷĿУ
+// תԭ
+// ============================================================================
+class SSAForm {
+public:
+    struct Value {
+        int var;            // vars ±
+        int version;        // 0 ʾڴֵ
+        int block;          // ֵڿ飬ֵΪ -1
+    };
+
+    struct Phi {
+        int var;
+        int value;
+        vector<int> args;   //  cfg.blocks[b].preds һһӦɴǰΪ -1
+    };
+
+    struct Inst {
+        IRInst inst;
+        int val[3];         // abr ӦSSAֵ-1 ʾ
+    };
+
+    ControlFlowGraph cfg;
+    vector<IROperand> vars;         // SSAı
+    vector<Value> values;
+    vector<vector<Phi> > phis;      // ÿphi
+    vector<vector<Inst> > code;     // ÿָ
+
+    // renamableû@tʱǲ
+    SSAForm(const IRFunction& fn, const set<string>& renamable) : cfg(fn) {
+        collectVariables(fn, renamable);
+        splitCode(fn);
+        placePhis();
+        rename();
+    }
+
+    // ָ slot Ų0:a 1:b 2:rǷ񱻶ȡ / ֵ
+    static bool usesOperand(IROpcode op, int slot) {
+        switch (op) {
+        case IR_ASSIGN:
+        case IR_IF: case IR_ELIF: case IR_DO:
+        case IR_RETURN: case IR_PUSH:
+            return slot == 0;
+        case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV:
+        case IR_GT: case IR_LT: case IR_GE: case IR_LE: case IR_EQ: case IR_NE:
+        case IR_BR:
+            return slot == 0 || slot == 1;
+        default:
+            return false;
+        }
+    }
+
+    static bool definesResult(IROpcode op) {
+        return op == IR_ASSIGN || op == IR_CALLR ||
+            (op >= IR_ADD && op <= IR_NE);
+    }
+
+    string valueName(const IRFunction& fn, int v) const {
+        stringstream ss;
+        ss << fn.operandText(vars[values[v].var]) << "#" << values[v].version;
+        return ss.str();
+    }
+
+    void print(const IRFunction& fn, ostream& out) const {
+        for (size_t b = 0; b < code.size(); ++b) {
+            out << "  B" << b << ":" << (cfg.reachable(static_cast<int>(b)) ? "" : " (unreachable)") << endl;
+            for (size_t i = 0; i < phis[b].size(); ++i) {
+                const Phi& phi = phis[b][i];
+                out << "    " << valueName(fn, phi.value) << " = phi(";
+                for (size_t j = 0; j < phi.args.size(); ++j) {
+                    if (j > 0) out << ", ";
+                    out << (phi.args[j] >= 0 ? valueName(fn, phi.args[j]) : string("_"))
+                        << " [B" << cfg.blocks[b].preds[j] << "]";
+                }
+                out << ")" << endl;
+            }
+            for (size_t i = 0; i < code[b].size(); ++i) {
+                const Inst& x = code[b][i];
+                out << "    (" << fn.opcodeText(x.inst) << ", " << operandText(fn, x, 0) << ", "
+                    << operandText(fn, x, 1) << ", " << operandText(fn, x, 2) << ")" << endl;
+            }
+        }
+    }
+
+    // ˳SSAд fn»ֻ飩޷ȫתʱ false Ҳ޸ fn
+    bool lower(IRFunction& fn) const {
+        size_t nb = code.size();
+        vector<vector<int> > in, out;
+        computeStorage(in, out);
+
+        // ÿȡİ汾ڱ
+        for (size_t b = 0; b < nb; ++b) {
+            if (!cfg.reachable(static_cast<int>(b))) continue;
+            vector<int> cur = in[b];
+            for (size_t i = 0; i < code[b].size(); ++i) {
+                const Inst& x = code[b][i];
+                for (int k = 0; k < 2; ++k) {
+                    if (x.val[k] >= 0 && cur[values[x.val[k]].var] != x.val[k]) return false;
+                }
+                if (x.val[2] >= 0) cur[values[x.val[2]].var] = x.val[2];
+            }
+        }
+
+        // phi תΪǰĩβĸֵ
+        vector<vector<pair<int, int> > > copies(nb);    // (Ŀ, Դֵ)
+        for (size_t b = 0; b < nb; ++b) {
+            for (size_t i = 0; i < phis[b].size(); ++i) {
+                const Phi& phi = phis[b][i];
+                int dest = phi.var;
+                for (size_t j = 0; j < phi.args.size(); ++j) {
+                    int q = cfg.blocks[b].preds[j];
+                    int arg = phi.args[j];
+                    if (arg < 0) continue;
+                    int src = values[arg].var;
+                    if (out[q][src] != arg) return false;
+                    if (src == dest) continue;
+                    if (cfg.blocks[q].succs.size() != 1) return false;
+                    copies[q].push_back(make_pair(dest, arg));
+                }
+            }
+        }
+        // ͬһеĸֵǲ壬Դܱһֵд
+        for (size_t q = 0; q < nb; ++q) {
+            for (size_t i = 0; i < copies[q].size(); ++i) {
+                for (size_t j = 0; j < copies[q].size(); ++j) {
+                    if (i != j && copies[q][j].first == values[copies[q][i].second].var) return false;
+                }
+            }
+        }
+
+        fn.clearCode();
+        for (size_t b = 0; b < nb; ++b) {
+            size_t n = code[b].size();
+            bool hasTerminator = n > 0 && ControlFlowGraph::endsBlock(code[b][n - 1].inst.marker());
+            size_t body = hasTerminator ? n - 1 : n;
+            for (size_t i = 0; i < body; ++i) {
+                fn.code.push_back(lowerInst(code[b][i]));
+            }
+            for (size_t i = 0; i < copies[b].size(); ++i) {
+                fn.code.push_back(IRInst(IR_ASSIGN, vars[values[copies[b][i].second].var],
+                    IROperand(), vars[copies[b][i].first]));
+            }
+            if (hasTerminator) {
+                fn.code.push_back(lowerInst(code[b][n - 1]));
+            }
+        }
+
+        ControlFlowGraph lowered(fn);
+        for (size_t b = 0; b < lowered.blocks.size(); ++b) {
+            if (lowered.blocks[b].first < lowered.blocks[b].last) {
+                fn.blockStarts.push_back(static_cast<uint32_t>(lowered.blocks[b].first));
+            }
+        }
+        return true;
+    }
+
+    // ÿ/ڴʵʱĸ汾-1 δ֪-2 汾ϣ
+    void computeStorage(vector<vector<int> >& in, vector<vector<int> >& out) const {
+        size_t nb = code.size();
+        in.assign(nb, vector<int>(vars.size(), -1));
+        out.assign(nb, vector<int>(vars.size(), -1));
+        in[cfg.entry()] = entryValue;
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t i = 0; i < cfg.rpo.size(); ++i) {
+                int b = cfg.rpo[i];
+                vector<int> cur(vars.size(), -1);
+                if (b == cfg.entry()) {
+                    cur = entryValue;
+                }
+                else {
+                    const vector<int>& preds = cfg.blocks[b].preds;
+                    for (size_t j = 0; j < preds.size(); ++j) {
+                        if (!cfg.reachable(preds[j])) continue;
+                        for (size_t v = 0; v < vars.size(); ++v) {
+                            int o = out[preds[j]][v];
+                            if (o == -1) continue;
+                            cur[v] = (cur[v] == -1 || cur[v] == o) ? o : -2;
+                        }
+                    }
+                }
+                // phi ǰĩβɸֵڴľphiֵ
+                for (size_t k = 0; k < phis[b].size(); ++k) {
+                    cur[phis[b][k].var] = phis[b][k].value;
+                }
+                if (cur != in[b]) {
+                    in[b] = cur;
+                    changed = true;
+                }
+                for (size_t k = 0; k < code[b].size(); ++k) {
+                    if (code[b][k].val[2] >= 0) cur[values[code[b][k].val[2]].var] = code[b][k].val[2];
+                }
+                if (cur != out[b]) {
+                    out[b] = cur;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+private:
+    map<uint32_t, int> varIds;      //  -> vars ±
+    vector<int> entryValue;         // ÿ #0 ֵ
+
+    string operandText(const IRFunction& fn, const Inst& x, int slot) const {
+        if (x.val[slot] >= 0) return valueName(fn, x.val[slot]);
+        const IROperand* ops[3] = { &x.inst.a, &x.inst.b, &x.inst.r };
+        return fn.operandText(*ops[slot]);
+    }
+
+    IRInst lowerInst(const Inst& x) const {
+        IRInst inst = x.inst;
+        if (x.val[0] >= 0) inst.a = vars[values[x.val[0]].var];
+        if (x.val[1] >= 0) inst.b = vars[values[x.val[1]].var];
+        if (x.val[2] >= 0) inst.r = vars[values[x.val[2]].var];
+        return inst;
+    }
+
+    int varOf(IROperand o) const {
+        map<uint32_t, int>::const_iterator it = varIds.find(o.bits);
+        return it != varIds.end() ? it->second : -1;
+    }
+
+    int newValue(int var, int block) {
+        Value v;
+        v.var = var;
+        v.version = 0;
+        for (size_t i = values.size(); i-- > 0;) {
+            if (values[i].var == var) {
+                v.version = values[i].version + 1;
+                break;
+            }
+        }
+        v.block = block;
+        values.push_back(v);
+        return static_cast<int>(values.size()) - 1;
+    }
+
+    void collectVariables(const IRFunction& fn, const set<string>& renamable) {
+        // лδ֪еְڴ洦
+        set<uint32_t> excluded;
+        for (size_t i = 0; i < fn.refs.size(); ++i) {
+            excluded.insert(IROperand::make(IRO_SYM, fn.refs[i].base).bits);
+            excluded.insert(fn.refs[i].index.bits);
+        }
+        for (size_t i = 0; i < fn.code.size(); ++i) {
+            const IRInst& inst = fn.code[i];
+            if (inst.opcode() == IR_RAW) {
+                excluded.insert(inst.a.bits);
+                excluded.insert(inst.b.bits);
+                excluded.insert(inst.r.bits);
+            }
+        }
+
+        for (size_t i = 0; i < fn.code.size(); ++i) {
+            const IRInst& inst = fn.code[i];
+            const IROperand ops[3] = { inst.a, inst.b, inst.r };
+            for (int k = 0; k < 3; ++k) {
+                bool touched = k == 2 ? definesResult(inst.opcode()) : usesOperand(inst.opcode(), k);
+                if (!touched || excluded.count(ops[k].bits) || varIds.count(ops[k].bits)) continue;
+                bool eligible = ops[k].kind() == IRO_TEMP ||
+                    (ops[k].kind() == IRO_SYM && renamable.count(fn.names[ops[k].index()]));
+                if (eligible) {
+                    varIds[ops[k].bits] = static_cast<int>(vars.size());
+                    vars.push_back(ops[k]);
+                }
+            }
+        }
+
+        for (size_t v = 0; v < vars.size(); ++v) {
+            entryValue.push_back(newValue(static_cast<int>(v), -1));
+        }
+    }
+
+    void splitCode(const IRFunction& fn) {
+        code.resize(cfg.blocks.size());
+        phis.resize(cfg.blocks.size());
+        for (size_t b = 0; b < cfg.blocks.size(); ++b) {
+            for (int i = cfg.blocks[b].first; i < cfg.blocks[b].last; ++i) {
+                Inst x;
+                x.inst = fn.code[i];
+                x.val[0] = x.val[1] = x.val[2] = -1;
+                code[b].push_back(x);
+            }
+        }
+    }
+
+    // ֻΪԾıphi֦SSA
+    void placePhis() {
+        vector<vector<int> > defBlocks(vars.size());
+        vector<bool> global(vars.size(), false);
+        for (size_t b = 0; b < code.size(); ++b) {
+            if (!cfg.reachable(static_cast<int>(b))) continue;
+            set<int> killed;
+            for (size_t i = 0; i < code[b].size(); ++i) {
+                const IRInst& inst = code[b][i].inst;
+                const IROperand ops[3] = { inst.a, inst.b, inst.r };
+                for (int k = 0; k < 2; ++k) {
+                    int v = usesOperand(inst.opcode(), k) ? varOf(ops[k]) : -1;
+                    if (v >= 0 && !killed.count(v)) global[v] = true;
+                }
+                int d = definesResult(inst.opcode()) ? varOf(ops[2]) : -1;
+                if (d >= 0) {
+                    killed.insert(d);
+                    if (defBlocks[d].empty() || defBlocks[d].back() != static_cast<int>(b)) {
+                        defBlocks[d].push_back(static_cast<int>(b));
+                    }
+                }
+            }
+        }
+
+        vector<vector<int> > df = cfg.dominanceFrontiers();
+        for (size_t v = 0; v < vars.size(); ++v) {
+            if (!global[v]) continue;
+            vector<bool> hasPhi(code.size(), false);
+            vector<int> work = defBlocks[v];
+            while (!work.empty()) {
+                int b = work.back();
+                work.pop_back();
+                for (size_t i = 0; i < df[b].size(); ++i) {
+                    int y = df[b][i];
+                    if (hasPhi[y]) continue;
+                    hasPhi[y] = true;
+                    Phi phi;
+                    phi.var = static_cast<int>(v);
+                    phi.value = -1;                     // rename ʱ
+                    phi.args.assign(cfg.blocks[y].preds.size(), -1);
+                    phis[y].push_back(phi);
+                    work.push_back(y);
+                }
+            }
+        }
+    }
+
+    void rename() {
+        vector<vector<int> > stacks(vars.size());
+        for (size_t v = 0; v < vars.size(); ++v) {
+            stacks[v].push_back(entryValue[v]);
+        }
+        vector<vector<int> > children = cfg.dominatorChildren();
+        renameBlock(cfg.entry(), stacks, children);
+    }
+
+    void renameBlock(int b, vector<vector<int> >& stacks, const vector<vector<int> >& children) {
+        vector<int> pushed;
+
+        for (size_t i = 0; i < phis[b].size(); ++i) {
+            int var = phis[b][i].var;
+            phis[b][i].value = newValue(var, b);
+            stacks[var].push_back(phis[b][i].value);
+            pushed.push_back(var);
+        }
+
+        for (size_t i = 0; i < code[b].size(); ++i) {
+            Inst& x = code[b][i];
+            IROpcode op = x.inst.opcode();
+            const IROperand ops[3] = { x.inst.a, x.inst.b, x.inst.r };
+            for (int k = 0; k < 2; ++k) {
+                int v = usesOperand(op, k) ? varOf(ops[k]) : -1;
+                if (v >= 0) x.val[k] = stacks[v].back();
+            }
+            int d = definesResult(op) ? varOf(ops[2]) : -1;
+            if (d >= 0) {
+                x.val[2] = newValue(d, b);
+                stacks[d].push_back(x.val[2]);
+                pushed.push_back(d);
+            }
+        }
+
+        const vector<int>& succs = cfg.blocks[b].succs;
+        for (size_t i = 0; i < succs.size(); ++i) {
+            int s = succs[i];
+            const vector<int>& preds = cfg.blocks[s].preds;
+            for (size_t j = 0; j < preds.size(); ++j) {
+                if (preds[j] != b) continue;
+                for (size_t k = 0; k < phis[s].size(); ++k) {
+                    phis[s][k].args[j] = stacks[phis[s][k].var].back();
+                }
+            }
+        }
+
+        for (size_t i = 0; i < children[b].size(); ++i) {
+            renameBlock(children[b][i], stacks, children);
+        }
+
+        for (size_t i = 0; i < pushed.size(); ++i) {
+            stacks[pushed[i]].pop_back();
+        }
+    }
+};
+
+// ============================================================================
+// Ծ
+// ڿͼÿڡڴԾ @t ʱͱ֣SSA汾
+// ԪءṹԱڴ洦д a[i]s.x 㶨ֵдʱ
+// ±ȡöȡ callUses е֣ɼ main ı
+// ڴ exitLive еȻԾɾͻɹá
+// ============================================================================
+class Liveness {
+public:
+    vector<set<string> > liveIn;
+    vector<set<string> > liveOut;
+
+    Liveness(const IRFunction& fn, const ControlFlowGraph& cfg,
+        const set<string>& callUses, const set<string>& exitLive)
+        : liveIn(cfg.blocks.size()), liveOut(cfg.blocks.size()) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int b = static_cast<int>(cfg.blocks.size()) - 1; b >= 0; --b) {
+                const CFGBlock& blk = cfg.blocks[b];
+                set<string> out;
+                if (blk.succs.empty()) {
+                    out = exitLive;
+                }
+                for (size_t k = 0; k < blk.succs.size(); ++k) {
+                    out.insert(liveIn[blk.succs[k]].begin(), liveIn[blk.succs[k]].end());
+                }
+                set<string> in = out;
+                for (int i = blk.last - 1; i >= blk.first; --i) {
+                    transfer(fn, fn.code[i], callUses, in);
+                }
+                if (out != liveOut[b] || in != liveIn[b]) {
+                    liveOut[b] = out;
+                    liveIn[b] = in;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // ָֵıʱûʱؿմ
+    static string defined(const IRFunction& fn, const IRInst& inst) {
+        IROperandKind kind = inst.r.kind();
+        if (!SSAForm::definesResult(inst.opcode()) || (kind != IRO_TEMP && kind != IRO_SYM)) {
+            return "";
+        }
+        return fn.operandText(inst.r);
+    }
+
+    // ָ֮ǰԾ֣ȥֵģ϶ȡ
+    static void transfer(const IRFunction& fn, const IRInst& inst, const set<string>& callUses, set<string>& live) {
+        string def = defined(fn, inst);
+        if (!def.empty()) {
+            live.erase(def);
+        }
+        IROpcode op = inst.opcode();
+        IROperand slots[3] = { inst.a, inst.b, inst.r };
+        for (int k = 0; k < 3; ++k) {
+            if (SSAForm::usesOperand(op, k) || slots[k].kind() == IRO_REF) {
+                addUse(fn, slots[k], live);
+            }
+        }
+        if (op == IR_CALL || op == IR_CALLR) {
+            live.insert(callUses.begin(), callUses.end());
+        }
+    }
+
+    // ıͽṹ壩ǵĶֵ԰Ծɾ
+    static set<string> scalarVariables(const SYMBOL& sym, const Function& func) {
+        set<string> res;
+        for (VariableDict::const_iterator it = func.variableDict.begin(); it != func.variableDict.end(); ++it) {
+            const Variable& v = it->second;
+            if (v.isArray || find(sym.structNameList.begin(), sym.structNameList.end(), v.type)
+                != sym.structNameList.end()) {
+                continue;
+            }
+            res.insert(it->first);
+        }
+        return res;
+    }
+
+    // main ıбɼԱĲ֣
+    // ıֺ $ֻ main ʹã
+    static set<string> mainGlobals(const set<string>& scalars) {
+        set<string> res;
+        for (set<string>::const_iterator it = scalars.begin(); it != scalars.end(); ++it) {
+            if (it->find('$') == string::npos) res.insert(*it);
+        }
+        return res;
+    }
+
+private:
+    static void addUse(const IRFunction& fn, IROperand o, set<string>& live) {
+        if (o.kind() == IRO_TEMP || o.kind() == IRO_SYM) {
+            live.insert(fn.operandText(o));
+        }
+        else if (o.kind() == IRO_REF) {
+            const IRRef& ref = fn.refs[o.index()];
+            live.insert(fn.names[ref.base]);
+            addUse(fn, ref.index, live);
+        }
+    }
+};
+
+// ============================================================================
+// IRοʵ֣
+// ֱִ QtGen ɵĻ Optimization ŻĺIRڱг
+// ͳִеָԼȽŻǰн
+// ִţmain ıȫֱԼıͲԼ
+// @tʱڵǰáԪغͽṹԱ a[3]p.x ʽţ
+// ṹôݣǰƽʱƻȥ
+// ============================================================================
+struct IRValue {
+    bool isFloat;
+    long long i;
+    double f;
+
+    IRValue() : isFloat(false), i(0), f(0) {}
+    static IRValue ofInt(long long v) { IRValue x; x.i = v; return x; }
+    static IRValue ofFloat(double v) { IRValue x; x.isFloat = true; x.f = v; return x; }
+
+    double asFloat() const { return isFloat ? f : static_cast<double>(i); }
+    bool isTrue() const { return isFloat ? f != 0 : i != 0; }
+    bool operator==(const IRValue& o) const {
+        return isFloat == o.isFloat && (isFloat ? f == o.f : i == o.i);
+    }
+    bool operator!=(const IRValue& o) const { return !(*this == o); }
+};
+
+inline ostream& operator<<(ostream& out, const IRValue& v) {
+    if (v.isFloat) out << v.f; else out << v.i;
+    return out;
+}
+
+class IRInterpreter {
+public:
+    typedef map<string, IRValue> Storage;
+
+    IRValue result;                 // main ķֵ
+    Storage globals;                // ʱ main ı
+    string error;                   // д󣬿ձʾ
+    unsigned long long executed;    // ִеָ
+    unsigned long long opCounts[IR_OPCODE_COUNT];
+    unsigned long long maxSteps;    // ָΪѭ
+
+    IRInterpreter(SYMBOL* sym, const vector<IRFunction*>& program)
+        : executed(0), maxSteps(100000000ULL), symTable(sym), mainTable(NULL), depth(0) {
+        memset(opCounts, 0, sizeof(opCounts));
+        for (size_t i = 0; i < program.size(); ++i) {
+            Code c;
+            c.fn = program[i];
+            c.table = NULL;
+            for (size_t j = 0; j < sym->functionList.size(); ++j) {
+                if (sym->functionList[j]->functionName == c.fn->name) {
+                    c.table = sym->functionList[j];
+                    break;
+                }
+            }
+            c.jump = jumpTargets(c.fn->code);
+            if (c.table && c.fn->name != "main") {
+                c.params = parameterNames(c.table);
+            }
+            functions[c.fn->name] = c;
+            if (c.fn->name == "main") mainTable = c.table;
+        }
+    }
+
+    //  main ʼִУʱ falseϢ error 
+    bool run() {
+        map<string, Code>::const_iterator it = functions.find("main");
+        if (it == functions.end()) {
+            error = "no main function";
+            return false;
+        }
+        Frame frame;
+        frame.code = &it->second;
+        frame.vars = &globals;
+        result = execute(frame);
+        return error.empty();
+    }
+
+    // еĵһͬ󡢷ֵĳ main ͬʱؿմ
+    static string firstDifference(const IRInterpreter& x, const IRInterpreter& y) {
+        stringstream ss;
+        if (x.error != y.error) {
+            ss << "error '" << x.error << "' vs '" << y.error << "'";
+            return ss.str();
+        }
+        if (x.result != y.result) {
+            ss << "main returned " << x.result << " vs " << y.result;
+            return ss.str();
+        }
+        Storage::const_iterator a = x.globals.begin();
+        Storage::const_iterator b = y.globals.begin();
+        while (a != x.globals.end() || b != y.globals.end()) {
+            // ıֺ $ֻһߴڣȽ
+            if (a != x.globals.end() && a->first.find('$') != string::npos) {
+                ++a;
+                continue;
+            }
+            if (b != y.globals.end() && b->first.find('$') != string::npos) {
+                ++b;
+                continue;
+            }
+            if (b == y.globals.end() || (a != x.globals.end() && a->first < b->first)) {
+                ss << a->first << " = " << a->second << " vs unset";
+                return ss.str();
+            }
+            if (a == x.globals.end() || b->first < a->first) {
+                ss << b->first << " unset vs " << b->second;
+                return ss.str();
+            }
+            if (a->second != b->second) {
+                ss << a->first << " = " << a->second << " vs " << b->second;
+                return ss.str();
+            }
+            ++a;
+            ++b;
+        }
+        return "";
+    }
+
+    // ͼͬıԹÿǵתĿ꣨-1 ʾ˳ִУ
+    static vector<int> jumpTargets(const IRCode& code) {
+        int n = static_cast<int>(code.size());
+        vector<int> jump(n, -1);
+        vector<pair<int, vector<int> > > ifs;       // (ȴ el , el б)
+        vector<pair<int, vector<int> > > loops;     // (wh, break б)
+        vector<int> conds;                          // ÿѭ do
+        for (int i = 0; i < n; ++i) {
+            switch (code[i].marker()) {
+            case IR_IF:
+                ifs.push_back(make_pair(i, vector<int>()));
+                break;
+            case IR_ELIF:
+                if (!ifs.empty()) ifs.back().first = i;
+                break;
+            case IR_EL:
+                if (!ifs.empty()) {
+                    if (ifs.back().first >= 0) jump[ifs.back().first] = i + 1;
+                    ifs.back().first = -1;
+                    ifs.back().second.push_back(i);
+                }
+                break;
+            case IR_IE:
+                if (!ifs.empty()) {
+                    if (ifs.back().first >= 0) jump[ifs.back().first] = i + 1;
+                    for (size_t k = 0; k < ifs.back().second.size(); ++k) {
+                        jump[ifs.back().second[k]] = i + 1;
+                    }
+                    ifs.pop_back();
+                }
+                break;
+            case IR_WH:
+                loops.push_back(make_pair(i, vector<int>()));
+                conds.push_back(-1);
+                break;
+            case IR_DO:
+                if (!conds.empty()) conds.back() = i;
+                break;
+            case IR_BREAK:
+                if (!loops.empty()) loops.back().second.push_back(i);
+                break;
+            case IR_CONTINUE:
+                if (!loops.empty()) jump[i] = loops.back().first;
+                break;
+            case IR_WE:
+                if (!loops.empty()) {
+                    jump[i] = loops.back().first;
+                    if (conds.back() >= 0) jump[conds.back()] = i + 1;
+                    for (size_t k = 0; k < loops.back().second.size(); ++k) {
+                        jump[loops.back().second[k]] = i + 1;
+                    }
+                    loops.pop_back();
+                    conds.pop_back();
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        return jump;
+    }
+
+    // ˳УĲַСparametersDict еĵַ
+    // Ҫ variableDict еģ
+    static vector<string> parameterNames(const Function* table) {
+        vector<pair<int, string> > params;
+        for (VariableDict::const_iterator it = table->parametersDict.begin();
+            it != table->parametersDict.end(); ++it) {
+            VariableDict::const_iterator var = table->variableDict.find(it->first);
+            params.push_back(make_pair(var != table->variableDict.end() ? var->second.addr : it->second.addr, it->first));
+        }
+        sort(params.begin(), params.end());
+        vector<string> res;
+        for (size_t k = 0; k < params.size(); ++k) {
+            res.push_back(params[k].second);
+        }
+        return res;
+    }
+
+    void printStats(ostream& out) const {
+        out << "Executed instructions: " << executed << endl;
+        for (int op = 0; op < IR_OPCODE_COUNT; ++op) {
+            if (opCounts[op] > 0) {
+                out << "  " << IR_OPCODE_NAMES[op] << ": " << opCounts[op] << endl;
+            }
+        }
+    }
+
+private:
+    struct Code {
+        IRFunction* fn;
+        Function* table;
+        vector<int> jump;           // ָתĿ꣬-1 ʾ˳ִ
+        vector<string> params;
+    };
+
+    struct Frame {
+        const Code* code;
+        Storage locals;
+        Storage* vars;              // main ָ globalsָ locals
+        vector<IRValue> temps;
+        vector<pair<IRValue, string> > args;    // push ʵμ
+        map<string, pair<Storage*, string> > aliases;   // 顢ṹβ -> (ʵڵĴ洢, ʵ)
+    };
+
+    SYMBOL* symTable;
+    const Function* mainTable;      // main ıȫֱ
+    map<string, Code> functions;
+    int depth;
+
+    IRValue fail(const string& msg) {
+        if (error.empty()) error = msg;
+        return IRValue();
+    }
+
+    IRValue execute(Frame& frame) {
+        const IRFunction& fn = *frame.code->fn;
+        const vector<int>& jump = frame.code->jump;
+        int n = static_cast<int>(fn.code.size());
+        int pc = 0;
+
+        while (pc < n && error.empty()) {
+            const IRInst& inst = fn.code[pc];
+            IROpcode op = inst.opcode();
+            int next = pc + 1;
+
+            if (++executed > maxSteps) {
+                return fail("step limit exceeded");
+            }
+            opCounts[op]++;
+
+            // óʱдؽıԭֵ
+            switch (op) {
+            case IR_ASSIGN: {
+                IRValue v = load(frame, inst.a);
+                if (error.empty()) store(frame, inst.r, v);
+                break;
+            }
+            case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV:
+            case IR_GT: case IR_LT: case IR_GE: case IR_LE: case IR_EQ: case IR_NE: {
+                IRValue v = binary(op, load(frame, inst.a), load(frame, inst.b));
+                if (error.empty()) store(frame, inst.r, v);
+                break;
+            }
+            case IR_IF: case IR_ELIF: case IR_DO:
+                if (!load(frame, inst.a).isTrue() && jump[pc] >= 0) next = jump[pc];
+                break;
+            case IR_BR:
+                if (!binary(static_cast<IROpcode>(inst.aux), load(frame, inst.a), load(frame, inst.b)).isTrue()) {
+                    next = static_cast<int>(inst.r.index());
+                }
+                break;
+            case IR_EL: case IR_WE: case IR_BREAK: case IR_CONTINUE:
+                if (jump[pc] >= 0) next = jump[pc];
+                break;
+            case IR_RETURN:
+                return load(frame, inst.a);
+            case IR_PUSH:
+                frame.args.push_back(make_pair(load(frame, inst.a),
+                    inst.a.kind() == IRO_SYM ? string(fn.names[inst.a.index()]) : string()));
+                break;
+            case IR_CALL:
+            case IR_CALLR: {
+                IRValue v = call(frame, fn.names[inst.a.index()]);
+                if (op == IR_CALLR && error.empty()) store(frame, inst.r, v);
+                break;
+            }
+            case IR_RAW:
+                return fail("unknown operator: " + fn.opcodeText(inst));
+            default:    // FUNwhie ֻǱ
+                break;
+            }
+            pc = next;
+        }
+        return IRValue();
+    }
+
+    IRValue call(Frame& caller, const string& name) {
+        map<string, Code>::const_iterator it = functions.find(name);
+        if (it == functions.end()) {
+            return fail("call to undefined function " + name);
+        }
+        if (depth >= 10000) {
+            return fail("call stack overflow in " + name);
+        }
+
+        const Code& callee = it->second;
+        Frame frame;
+        frame.code = &callee;
+        frame.vars = &frame.locals;
+
+        // ѹļʵε
+        size_t count = callee.params.size();
+        if (count > caller.args.size()) {
+            return fail("too few arguments for " + name);
+        }
+        size_t first = caller.args.size() - count;
+        for (size_t k = 0; k < count; ++k) {
+            const string& param = callee.params[k];
+            string arg = caller.args[first + k].second;
+            if (!arg.empty() && isAggregate(callee.table, param)) {
+                // 顢ṹ尴ôݣβֱָʵεԪ
+                Storage* storage = &locate(caller, arg);
+                frame.aliases[param] = make_pair(storage, arg);
+            }
+            else {
+                frame.locals[param] = caller.args[first + k].first;
+            }
+        }
+
+        depth++;
+        IRValue v = execute(frame);
+        depth--;
+
+        caller.args.resize(first);
+        return v;
+    }
+
+    bool isAggregate(const Function* table, const string& name) const {
+        VariableDict::const_iterator it = table->variableDict.find(name);
+        return it != table->variableDict.end() &&
+            (it->second.isArray || !symTable->basicTypes.count(it->second.type));
+    }
+
+    // ڵĴ洢顢ṹβεԪػɵʵεԪ
+    Storage& locate(Frame& frame, string& key) {
+        string root = key.substr(0, key.find_first_of(".["));
+        map<string, pair<Storage*, string> >::const_iterator it = frame.aliases.find(root);
+        if (it != frame.aliases.end()) {
+            key = it->second.second + key.substr(root.size());
+            return *it->second.first;
+        }
+        return storageFor(frame, key);
+    }
+
+    // ڵĴ洢Լıڵ֡У main ı
+    Storage& storageFor(Frame& frame, const string& key) {
+        size_t end = key.find_first_of(".[");
+        string root = key.substr(0, end);
+        if (frame.vars != &globals && frame.code->table &&
+            frame.code->table->variableDict.find(root) != frame.code->table->variableDict.end()) {
+            return frame.locals;
+        }
+        return globals;
+    }
+
+    // ֵ storageFor ͬԼııУ main ıУ
+    // x.m ʽȡṹԱ
+    const Variable* declaration(Frame& frame, const string& name) const {
+        size_t dot = name.find('.');
+        string root = name.substr(0, dot);
+        const Function* table = frame.code->table;
+        if (frame.vars == &globals || !table || table->variableDict.find(root) == table->variableDict.end()) {
+            table = mainTable;
+        }
+        if (!table) return NULL;
+        VariableDict::const_iterator it = table->variableDict.find(root);
+        if (it == table->variableDict.end()) return NULL;
+        if (dot == string::npos) return &it->second;
+        for (size_t j = 0; j < symTable->structList.size(); ++j) {
+            const Struct* st = symTable->structList[j];
+            if (st->structName != it->second.type) continue;
+            VariableDict::const_iterator m = st->variableDict.find(name.substr(dot + 1));
+            return m != st->variableDict.end() ? &m->second : NULL;
+        }
+        return NULL;
+    }
+
+    // VMJITͬԽ飺±겻ΪҲܳĳ
+    // δָȵβγδֻ֪鸺
+    void checkIndex(Frame& frame, const string& name, const IRValue& index) {
+        const Variable* v = declaration(frame, name);
+        if (!v || !v->isArray) return;
+        long long i = index.isFloat ? static_cast<long long>(index.f) : index.i;
+        if (i < 0 || (v->arraySize > 0 && i >= v->arraySize)) {
+            fail("array index out of range");
+        }
+    }
+
+    // ӦĴ洢λ±ֵǷԽ
+    string cellName(Frame& frame, IROperand o) {
+        const IRFunction& fn = *frame.code->fn;
+        if (o.kind() == IRO_REF) {
+            const IRRef& ref = fn.refs[o.index()];
+            string key = fn.names[ref.base];
+            if (!ref.index.isNone()) {
+                IRValue index = load(frame, ref.index);
+                checkIndex(frame, key, index);
+                stringstream ss;
+                ss << "[" << index << "]";
+                key += ss.str();
+            }
+            if (ref.member != IR_NO_MEMBER) {
+                key += ".";
+                key += fn.names[ref.member];
+            }
+            return key;
+        }
+
+        // δܲõд p.a[i]ı±
+        string text = fn.names[o.index()];
+        size_t lb = text.find('[');
+        size_t rb = text.find(']', lb);
+        if (lb != string::npos && rb != string::npos) {
+            IRValue index = loadText(frame, text.substr(lb + 1, rb - lb - 1));
+            checkIndex(frame, text.substr(0, lb), index);
+            stringstream ss;
+            ss << text.substr(0, lb) << "[" << index << "]" << text.substr(rb + 1);
+            return ss.str();
+        }
+        return text;
+    }
+
+    IRValue loadText(Frame& frame, const string& text) {
+        if (text.empty()) return IRValue();
+        if (isdigit(static_cast<unsigned char>(text[0])) || text[0] == '-') return parseConstant(text);
+        if (text.size() > 2 && text[0] == '@' && text[1] == 't') {
+            size_t t = static_cast<size_t>(atol(text.c_str() + 2));
+            return t < frame.temps.size() ? frame.temps[t] : IRValue();
+        }
+        string key = text;
+        Storage& s = locate(frame, key);
+        Storage::const_iterator it = s.find(key);
+        return it != s.end() ? it->second : IRValue();
+    }
+
+    static IRValue parseConstant(const string& text) {
+        if (text.size() >= 3 && text[0] == '\'') {
+            return IRValue::ofInt(static_cast<unsigned char>(text[1]));
+        }
+        if (text.find_first_of(".eE") != string::npos) {
+            return IRValue::ofFloat(atof(text.c_str()));
+        }
+        return IRValue::ofInt(atoll(text.c_str()));
+    }
+
+    IRValue load(Frame& frame, IROperand o) {
+        const IRFunction& fn = *frame.code->fn;
+        switch (o.kind()) {
+        case IRO_IMM:
+            return IRValue::ofInt(o.immValue());
+        case IRO_CONST:
+            return parseConstant(fn.consts[o.index()]);
+        case IRO_TEMP:
+            return o.index() < frame.temps.size() ? frame.temps[o.index()] : IRValue();
+        case IRO_SYM:
+        case IRO_REF: {
+            string key = cellName(frame, o);
+            Storage& s = locate(frame, key);
+            Storage::const_iterator it = s.find(key);
+            return it != s.end() ? it->second : IRValue();
+        }
+        default:
+            return IRValue();
+        }
+    }
+
+    void store(Frame& frame, IROperand o, const IRValue& v) {
+        if (o.kind() == IRO_TEMP) {
+            if (o.index() >= frame.temps.size()) frame.temps.resize(o.index() + 1);
+            frame.temps[o.index()] = v;
+        }
+        else if (o.kind() == IRO_SYM || o.kind() == IRO_REF) {
+            string key = cellName(frame, o);
+            if (error.empty()) locate(frame, key)[key] = v;
+        }
+        else {
+            fail("assignment to a constant");
+        }
+    }
+
+    IRValue binary(IROpcode op, const IRValue& x, const IRValue& y) {
+        if (x.isFloat || y.isFloat) {
+            double a = x.asFloat(), b = y.asFloat();
+            switch (op) {
+            case IR_ADD: return IRValue::ofFloat(a + b);
+            case IR_SUB: return IRValue::ofFloat(a - b);
+            case IR_MUL: return IRValue::ofFloat(a * b);
+            case IR_DIV: return b == 0 ? fail("division by zero") : IRValue::ofFloat(a / b);
+            case IR_GT: return IRValue::ofInt(a > b);
+            case IR_LT: return IRValue::ofInt(a < b);
+            case IR_GE: return IRValue::ofInt(a >= b);
+            case IR_LE: return IRValue::ofInt(a <= b);
+            case IR_EQ: return IRValue::ofInt(a == b);
+            case IR_NE: return IRValue::ofInt(a != b);
+            default: return IRValue();
+            }
+        }
+        long long a = x.i, b = y.i;
+        switch (op) {
+        case IR_ADD: return IRValue::ofInt(a + b);
+        case IR_SUB: return IRValue::ofInt(a - b);
+        case IR_MUL: return IRValue::ofInt(a * b);
+        case IR_DIV: return b == 0 ? fail("division by zero") : IRValue::ofInt(a / b);
+        case IR_GT: return IRValue::ofInt(a > b);
+        case IR_LT: return IRValue::ofInt(a < b);
+        case IR_GE: return IRValue::ofInt(a >= b);
+        case IR_LE: return IRValue::ofInt(a <= b);
+        case IR_EQ: return IRValue::ofInt(a == b);
+        case IR_NE: return IRValue::ofInt(a != b);
+        default: return IRValue();
+        }
+    }
+};
+
+// ============================================================================
+// Ĵֽ
+// ŻĺIRΪյļĴִֽУڸг
+// ÿ֡һ64λۣ[][][ʱݴ]
+// Ĵ֡ڲۺšͽṹ֡ţΪʱô
+// дžԵַmain ֡λջףıȫֱ
+//  LDG/STG ȰԵַʡջ͵ü¼ǰһηá
+// ȽϵĽֻ if/elif/do ʹʱϲΪһȽת
+// GCC/Clang ü goto ɣ˻ switch
+// ֻ֧򣺺㳣޷дʱ compileError ˵ԭ
+// ============================================================================
+enum BCOpcode {
+    BC_MOV,                                 // a = b
+    BC_ADD, BC_SUB, BC_MUL, BC_DIV,         // a = b op c
+    BC_GT, BC_LT, BC_GE, BC_LE, BC_EQ, BC_NE,
+    BC_LDG, BC_STG,                         // a = ջ[b]ջ[b] = aȫֱ
+    BC_LDX, BC_STX,                         // a = fp[b + c]fp[b + c] = ad ΪԪظ-1 ʾδ֪
+    BC_LDXG, BC_STXG,                       // ͬϣַΪջ
+    BC_LDXP, BC_STXP,                       // ͬϣַΪ b дŵľԵַ
+    BC_ADDR,                                // a = fp + b ľԵַ
+    BC_JMP,                                 //  a
+    BC_JZ,                                  // b Ϊ 0 ʱ a
+    BC_JGT, BC_JLT, BC_JGE, BC_JLE, BC_JEQ, BC_JNE,   // b op c ʱ a
+    BC_CALL,                                // ú a֡ fp + b ʼֵ c-1 ʾ
+    BC_RET,                                 //  a
+    BC_OPCODE_COUNT
+};
+
+static const char* const BC_OPCODE_NAMES[BC_OPCODE_COUNT] = {
+    "mov", "add", "sub", "mul", "div", "gt", "lt", "ge", "le", "eq", "ne",
+    "ldg", "stg", "ldx", "stx", "ldxg", "stxg", "ldxp", "stxp", "addr",
+    "jmp", "jz", "jgt", "jlt", "jge", "jle", "jeq", "jne", "call", "ret"
+};
+
+struct BCInst {
+    int op;
+    int a, b, c, d;
+
+    BCInst(int o = BC_MOV, int x = 0, int y = 0, int z = 0, int w = 0) : op(o), a(x), b(y), c(z), d(w) {}
+};
+
+class X86Jit;
+
+class BytecodeVM {
+    friend class X86Jit;
+
+public:
+    long long result;           // main ķֵ
+    string error;               // д󣬿ձʾ
+    string compileError;        // ʧܵԭ򣬷ǿʱ
+
+    static const int STACK_SLOTS = 1 << 20;
+    static const int MAX_DEPTH = 10000;
+
+    BytecodeVM(SYMBOL* sym, const vector<IRFunction*>& program) : result(0), symTable(sym), mainIndex(-1) {
+        for (size_t i = 0; i < program.size(); ++i) {
+            BCFunction f;
+            f.name = program[i]->name;
+            f.table = findTable(f.name);
+            if (f.table && f.name != "main") {
+                f.params = static_cast<int>(IRInterpreter::parameterNames(f.table).size());
+            }
+            if (f.name == "main") mainIndex = static_cast<int>(i);
+            functionIds[f.name] = static_cast<int>(i);
+            functions.push_back(f);
+        }
+        if (mainIndex < 0) {
+            compileError = "no main function";
+            return;
+        }
+
+        // main ıȷĲۺŷȫֱ
+        layoutVariables(mainIndex, globals);
+        for (size_t i = 0; i < program.size() && compileError.empty(); ++i) {
+            lower(static_cast<int>(i), *program[i]);
+        }
+    }
+
+    size_t instructionCount() const { return code.size(); }
+    size_t byteSize() const { return code.size() * sizeof(BCInst); }
+    size_t functionCount() const { return functions.size(); }
+
+    //  main ʼִУʱ falseϢ error 
+    bool run() {
+        if (!compileError.empty()) {
+            error = compileError;
+            return false;
+        }
+        // ֡ڵʱ㣬ջҪʼ
+        unique_ptr<long long[]> stack(new long long[STACK_SLOTS]);
+        vector<CallRecord> calls(MAX_DEPTH);
+        execute(stack.get(), &calls[0]);
+        return error.empty();
+    }
+
+    void print(ostream& out) const {
+        for (size_t i = 0; i < functions.size(); ++i) {
+            const BCFunction& f = functions[i];
+            out << f.name << ": params=" << f.params << " frame=" << f.frameSize << endl;
+            int end = i + 1 < functions.size() ? functions[i + 1].entry : static_cast<int>(code.size());
+            for (int k = f.entry; k < end; ++k) {
+                const BCInst& inst = code[k];
+                out << "  " << k << ": " << BC_OPCODE_NAMES[inst.op] << " "
+                    << inst.a << ", " << inst.b << ", " << inst.c << ", " << inst.d << endl;
+            }
+        }
+    }
+
+private:
+    // λ
+    enum LocationKind {
+        LOC_FRAME,      // ֡еĲۣŵľۺϣ
+        LOC_POINTER     // ۺϲдʵεľԵַ
+    };
+
+    struct Location {
+        LocationKind kind;
+        int slot;
+        int length;         // ۺϵԪظΪ 0δ֪Ϊ -1
+        const Struct* type; // ṹͣΪ NULL
+
+        Location() : kind(LOC_FRAME), slot(0), length(0), type(NULL) {}
+        bool aggregate() const { return length != 0; }
+    };
+
+    typedef map<string, Location> Layout;
+
+    // ۵;JITĴ
+    enum SlotKind {
+        SLOT_VALUE,         // ʱݴ
+        SLOT_CONSTANT,      // ֵ initial 
+        SLOT_AGGREGATE      // ṹԪأַܰ
+    };
+
+    struct BCFunction {
+        string name;
+        Function* table;
+        int entry;
+        int params;
+        int frameSize;
+        int frameNeed;                  // ֡ϵʱдʵ
+        vector<long long> initial;      // ֮۵ĳֵΪΪ0
+        vector<uint8_t> slotKinds;
+
+        BCFunction() : table(NULL), entry(0), params(0), frameSize(0), frameNeed(0) {}
+    };
+
+    struct CallRecord {
+        const BCInst* ret;
+        long long* fp;
+        int dst;
+    };
+
+    // ķʷʽ
+    enum AccessKind { ACC_SLOT, ACC_GLOBAL, ACC_INDEX, ACC_INDEX_GLOBAL, ACC_INDEX_POINTER, ACC_INVALID };
+
+    struct Access {
+        AccessKind kind;
+        int slot;       // ۺšԵַۺϻַ
+        int index;      // ±ڵĲ
+        int length;
+
+        Access(AccessKind k = ACC_INVALID, int s = 0, int i = 0, int l = 0) : kind(k), slot(s), index(i), length(l) {}
+    };
+
+    // һʱ״̬
+    struct Lowering {
+        const IRFunction* fn;
+        BCFunction* out;
+        Layout vars;
+        map<uint32_t, int> temps;
+        map<long long, int> constants;
+        int nextSlot;
+        int scratch[3];
+        int pushed;
+        vector<int> irStart;                // ÿIRָӦĵһֽ
+        vector<int> jumpFixups;             // a ݴIR±תָ
+        vector<int> frameFixups;            // Ҫ֡Сʵд
+    };
+
+    SYMBOL* symTable;
+    vector<BCFunction> functions;
+    map<string, int> functionIds;
+    vector<BCInst> code;
+    Layout globals;
+    int mainIndex;
+
+    Function* findTable(const string& name) const {
+        for (size_t j = 0; j < symTable->functionList.size(); ++j) {
+            if (symTable->functionList[j]->functionName == name) {
+                return symTable->functionList[j];
+            }
+        }
+        return NULL;
+    }
+
+    const Struct* findStruct(const string& name) const {
+        for (size_t j = 0; j < symTable->structList.size(); ++j) {
+            if (symTable->structList[j]->structName == name) {
+                return symTable->structList[j];
+            }
+        }
+        return NULL;
+    }
+
+    bool fail(const string& msg) {
+        if (compileError.empty()) compileError = msg;
+        return false;
+    }
+
+    // ṹԱַ˳ռһֵۣ֧ĳԱͷ -1
+    int memberOffset(const Struct* st, const string& member) const {
+        VariableDict::const_iterator target = st->variableDict.find(member);
+        if (target == st->variableDict.end() || target->second.isArray) return -1;
+        int offset = 0;
+        for (VariableDict::const_iterator it = st->variableDict.begin(); it != st->variableDict.end(); ++it) {
+            if (it->second.addr < target->second.addr) offset++;
+        }
+        return offset;
+    }
+
+    int memberCount(const Struct* st) const {
+        return static_cast<int>(st->variableDict.size());
+    }
+
+    // ռǰĲۣں
+    void layoutVariables(int id, Layout& vars) {
+        BCFunction& f = functions[id];
+        int next = 0;
+        if (!f.table) {
+            f.frameSize = 0;
+            return;
+        }
+        vector<string> params = f.name == "main" ? vector<string>() : IRInterpreter::parameterNames(f.table);
+        for (size_t k = 0; k < params.size(); ++k) {
+            const Variable& v = f.table->parametersDict.find(params[k])->second;
+            Location loc;
+            loc.slot = next++;
+            loc.type = findStruct(v.type);
+            if (v.isArray || loc.type) {
+                loc.kind = LOC_POINTER;
+                loc.length = v.isArray ? (v.arraySize > 0 ? v.arraySize : -1) : memberCount(loc.type);
+            }
+            vars[params[k]] = loc;
+        }
+        for (VariableDict::const_iterator it = f.table->variableDict.begin();
+            it != f.table->variableDict.end(); ++it) {
+            if (vars.find(it->first) != vars.end()) continue;
+            const Variable& v = it->second;
+            Location loc;
+            loc.slot = next;
+            loc.type = findStruct(v.type);
+            int element = loc.type ? memberCount(loc.type) : 1;
+            if (v.isArray) {
+                if (loc.type) {
+                    fail("arrays of structs are not supported: " + it->first);
+                    return;
+                }
+                loc.length = v.arraySize;
+                next += v.arraySize;
+            }
+            else {
+                loc.length = loc.type ? element : 0;
+                next += element;
+            }
+            vars[it->first] = loc;
+        }
+        f.frameSize = next;
+    }
+
+    int newSlot(Lowering& L) {
+        return L.nextSlot++;
+    }
+
+    int constantSlot(Lowering& L, long long value) {
+        map<long long, int>::const_iterator it = L.constants.find(value);
+        if (it != L.constants.end()) return it->second;
+        int slot = newSlot(L);
+        L.constants[value] = slot;
+        return slot;
+    }
+
+    int tempSlot(Lowering& L, uint32_t t) {
+        map<uint32_t, int>::const_iterator it = L.temps.find(t);
+        if (it != L.temps.end()) return it->second;
+        int slot = newSlot(L);
+        L.temps[t] = slot;
+        return slot;
+    }
+
+    void emit(const BCInst& inst) {
+        code.push_back(inst);
+    }
+
+    // λãı֡У main ֡Уglobal Ϊ true
+    const Location* find(const Lowering& L, const string& name, bool& global) const {
+        global = false;
+        Layout::const_iterator it = L.vars.find(name);
+        if (it != L.vars.end()) return &it->second;
+        global = true;
+        it = globals.find(name);
+        return it != globals.end() ? &it->second : NULL;
+    }
+
+    const Location* locate(Lowering& L, const string& name, bool& global) {
+        const Location* loc = find(L, name, global);
+        if (!loc) fail("unknown variable " + name + " in " + L.fn->name);
+        return loc;
+    }
+
+    // ѲΪʷʽ±Ҫʱ scratch 
+    Access resolve(Lowering& L, IROperand o, int scratch) {
+        const IRFunction& fn = *L.fn;
+        switch (o.kind()) {
+        case IRO_TEMP:
+            return Access(ACC_SLOT, tempSlot(L, o.index()));
+        case IRO_IMM:
+            return Access(ACC_SLOT, constantSlot(L, o.immValue()));
+        case IRO_CONST: {
+            string text = fn.consts[o.index()];
+            if (text.find_first_of(".eE") != string::npos) {
+                fail("floating-point constant " + text + " is not supported");
+                return Access();
+            }
+            return Access(ACC_SLOT, constantSlot(L, atoll(text.c_str())));
+        }
+        case IRO_SYM: {
+            string text = fn.names[o.index()];
+            if (text.size() >= 3 && text[0] == '\'') {
+                return Access(ACC_SLOT, constantSlot(L, static_cast<unsigned char>(text[1])));
+            }
+            if (text.find_first_of(".[") != string::npos) {
+                fail("unsupported operand " + text);
+                return Access();
+            }
+            bool global;
+            const Location* loc = locate(L, text, global);
+            if (!loc) return Access();
+            if (loc->aggregate()) {
+                fail("aggregate " + text + " used as a value");
+                return Access();
+            }
+            return Access(global ? ACC_GLOBAL : ACC_SLOT, loc->slot);
+        }
+        case IRO_REF: {
+            const IRRef& ref = fn.refs[o.index()];
+            string base = fn.names[ref.base];
+            bool global;
+            const Location* loc = locate(L, base, global);
+            if (!loc) return Access();
+            if (!loc->aggregate()) {
+                fail(base + " is not an array or struct");
+                return Access();
+            }
+
+            int offset = 0;
+            int indexSlot = -1;
+            if (ref.member != IR_NO_MEMBER) {
+                offset = loc->type ? memberOffset(loc->type, fn.names[ref.member]) : -1;
+                if (offset < 0) {
+                    fail("unsupported member access " + fn.operandText(o));
+                    return Access();
+                }
+            }
+            else if (ref.index.kind() == IRO_IMM) {
+                offset = ref.index.immValue();
+                if (offset < 0 || (loc->length > 0 && offset >= loc->length)) {
+                    fail("array index out of range: " + fn.operandText(o));
+                    return Access();
+                }
+            }
+            else {
+                indexSlot = load(L, ref.index, scratch);
+            }
+
+            if (loc->kind == LOC_POINTER) {
+                if (indexSlot < 0) indexSlot = constantSlot(L, offset);
+                return Access(ACC_INDEX_POINTER, loc->slot, indexSlot, loc->length);
+            }
+            if (indexSlot < 0) {
+                return Access(global ? ACC_GLOBAL : ACC_SLOT, loc->slot + offset);
+            }
+            return Access(global ? ACC_INDEX_GLOBAL : ACC_INDEX, loc->slot, indexSlot, loc->length);
+        }
+        default:
+            fail("unsupported operand " + fn.operandText(o));
+            return Access();
+        }
+    }
+
+    // ȡֵڲۣҪʱ뵽 scratch
+    int load(Lowering& L, IROperand o, int scratch) {
+        Access acc = resolve(L, o, scratch);
+        switch (acc.kind) {
+        case ACC_SLOT:
+            return acc.slot;
+        case ACC_GLOBAL:
+            emit(BCInst(BC_LDG, scratch, acc.slot));
+            return scratch;
+        case ACC_INDEX:
+            emit(BCInst(BC_LDX, scratch, acc.slot, acc.index, acc.length));
+            return scratch;
+        case ACC_INDEX_GLOBAL:
+            emit(BCInst(BC_LDXG, scratch, acc.slot, acc.index, acc.length));
+            return scratch;
+        case ACC_INDEX_POINTER:
+            emit(BCInst(BC_LDXP, scratch, acc.slot, acc.index, acc.length));
+            return scratch;
+        default:
+            return scratch;
+        }
+    }
+
+    // ֱдĲۣҪ store ʱ -1
+    static int directSlot(const Access& acc) {
+        return acc.kind == ACC_SLOT ? acc.slot : -1;
+    }
+
+    void store(const Access& acc, int src) {
+        switch (acc.kind) {
+        case ACC_SLOT:
+            if (acc.slot != src) emit(BCInst(BC_MOV, acc.slot, src));
+            break;
+        case ACC_GLOBAL:
+            emit(BCInst(BC_STG, src, acc.slot));
+            break;
+        case ACC_INDEX:
+            emit(BCInst(BC_STX, src, acc.slot, acc.index, acc.length));
+            break;
+        case ACC_INDEX_GLOBAL:
+            emit(BCInst(BC_STXG, src, acc.slot, acc.index, acc.length));
+            break;
+        case ACC_INDEX_POINTER:
+            emit(BCInst(BC_STXP, src, acc.slot, acc.index, acc.length));
+            break;
+        default:
+            break;
+        }
+    }
+
+    Access destination(Lowering& L, IROperand o) {
+        if (o.kind() != IRO_TEMP && o.kind() != IRO_SYM && o.kind() != IRO_REF) {
+            fail("assignment to a constant in " + L.fn->name);
+            return Access();
+        }
+        return resolve(L, o, L.scratch[2]);
+    }
+
+    static int binaryOpcode(IROpcode op) {
+        switch (op) {
+        case IR_ADD: return BC_ADD;
+        case IR_SUB: return BC_SUB;
+        case IR_MUL: return BC_MUL;
+        case IR_DIV: return BC_DIV;
+        case IR_GT: return BC_GT;
+        case IR_LT: return BC_LT;
+        case IR_GE: return BC_GE;
+        case IR_LE: return BC_LE;
+        case IR_EQ: return BC_EQ;
+        default: return BC_NE;
+        }
+    }
+
+    // ʱתȽȡ
+    static int branchIfFalse(IROpcode op) {
+        switch (op) {
+        case IR_GT: return BC_JLE;
+        case IR_LT: return BC_JGE;
+        case IR_GE: return BC_JLT;
+        case IR_LE: return BC_JGT;
+        case IR_EQ: return BC_JNE;
+        default: return BC_JEQ;
+        }
+    }
+
+    void lower(int id, const IRFunction& fn) {
+        BCFunction& f = functions[id];
+        Lowering L;
+        L.fn = &fn;
+        L.out = &f;
+        L.pushed = 0;
+        if (id == mainIndex) L.vars = globals;
+        else layoutVariables(id, L.vars);
+        if (!compileError.empty()) return;
+        L.nextSlot = f.frameSize;
+        for (int k = 0; k < 3; ++k) L.scratch[k] = newSlot(L);
+        f.entry = static_cast<int>(code.size());
+
+        vector<int> jump = IRInterpreter::jumpTargets(fn.code);
+        int n = static_cast<int>(fn.code.size());
+
+        L.irStart.assign(n + 1, 0);
+        int maxPushed = 0;
+        for (int i = 0; i < n && compileError.empty(); ++i) {
+            L.irStart[i] = static_cast<int>(code.size());
+            const IRInst& inst = fn.code[i];
+            IROpcode op = inst.opcode();
+            switch (op) {
+            case IR_ASSIGN: {
+                Access dst = destination(L, inst.r);
+                int slot = directSlot(dst);
+                int src = load(L, inst.a, slot >= 0 ? slot : L.scratch[0]);
+                store(dst, src);
+                break;
+            }
+            case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV:
+            case IR_GT: case IR_LT: case IR_GE: case IR_LE: case IR_EQ: case IR_NE: {
+                int x = load(L, inst.a, L.scratch[0]);
+                int y = load(L, inst.b, L.scratch[1]);
+                Access dst = destination(L, inst.r);
+                int slot = directSlot(dst);
+                emit(BCInst(binaryOpcode(op), slot >= 0 ? slot : L.scratch[0], x, y));
+                if (slot < 0) store(dst, L.scratch[0]);
+                break;
+            }
+            case IR_IF: case IR_ELIF: case IR_DO:
+                if (jump[i] >= 0) {
+                    int cond = load(L, inst.a, L.scratch[0]);
+                    L.jumpFixups.push_back(static_cast<int>(code.size()));
+                    emit(BCInst(BC_JZ, jump[i], cond));
+                }
+                break;
+            case IR_BR: {
+                // ںϵıȽתֱӶӦһת0Ƚϲȵ JZ
+                IROpcode cmp = static_cast<IROpcode>(inst.aux);
+                int x = load(L, inst.a, L.scratch[0]);
+                L.jumpFixups.push_back(static_cast<int>(code.size()));
+                if (cmp == IR_NE && inst.b == IROperand::imm(0)) {
+                    emit(BCInst(BC_JZ, static_cast<int>(inst.r.index()), x));
+                }
+                else {
+                    emit(BCInst(branchIfFalse(cmp), static_cast<int>(inst.r.index()), x, load(L, inst.b, L.scratch[1])));
+                }
+                break;
+            }
+            case IR_EL: case IR_WE: case IR_BREAK: case IR_CONTINUE:
+                if (jump[i] >= 0) {
+                    L.jumpFixups.push_back(static_cast<int>(code.size()));
+                    emit(BCInst(BC_JMP, jump[i]));
+                }
+                break;
+            case IR_RETURN:
+                emit(BCInst(BC_RET, inst.a.isNone() ? constantSlot(L, 0) : load(L, inst.a, L.scratch[0])));
+                break;
+            case IR_PUSH:
+                lowerPush(L, inst.a);
+                maxPushed = max(maxPushed, L.pushed);
+                break;
+            case IR_CALL: case IR_CALLR: {
+                string name = fn.names[inst.a.index()];
+                map<string, int>::const_iterator callee = functionIds.find(name);
+                if (callee == functionIds.end()) {
+                    fail("call to undefined function " + name);
+                    break;
+                }
+                if (functions[callee->second].params != L.pushed) {
+                    fail("wrong number of arguments for " + name);
+                    break;
+                }
+                Access dst;
+                int slot = -1;
+                if (op == IR_CALLR) {
+                    dst = destination(L, inst.r);
+                    slot = directSlot(dst) >= 0 ? directSlot(dst) : L.scratch[0];
+                }
+                L.frameFixups.push_back(static_cast<int>(code.size()));
+                emit(BCInst(BC_CALL, callee->second, 0, slot));
+                if (op == IR_CALLR && directSlot(dst) < 0) store(dst, slot);
+                L.pushed = 0;
+                break;
+            }
+            case IR_RAW:
+                fail("unknown operator: " + fn.opcodeText(inst));
+                break;
+            default:    // FUNwhie ֻǱ
+                break;
+            }
+        }
+        L.irStart[n] = static_cast<int>(code.size());
+        emit(BCInst(BC_RET, constantSlot(L, 0)));
+
+        for (size_t k = 0; k < L.jumpFixups.size(); ++k) {
+            BCInst& inst = code[L.jumpFixups[k]];
+            inst.a = L.irStart[inst.a];
+        }
+        f.frameSize = L.nextSlot;
+        f.frameNeed = f.frameSize + maxPushed;
+        for (size_t k = 0; k < L.frameFixups.size(); ++k) {
+            BCInst& inst = code[L.frameFixups[k]];
+            if (inst.op == BC_CALL) inst.b = f.frameSize;
+            else inst.a += f.frameSize;
+        }
+        f.initial.assign(f.frameSize - f.params, 0);
+        f.slotKinds.assign(f.frameSize, SLOT_VALUE);
+        for (map<long long, int>::const_iterator it = L.constants.begin(); it != L.constants.end(); ++it) {
+            f.initial[it->second - f.params] = it->first;
+            f.slotKinds[it->second] = SLOT_CONSTANT;
+        }
+        for (Layout::const_iterator it = L.vars.begin(); it != L.vars.end(); ++it) {
+            if (it->second.kind == LOC_FRAME && it->second.aggregate()) {
+                for (int k = 0; k < it->second.length; ++k) f.slotKinds[it->second.slot + k] = SLOT_AGGREGATE;
+            }
+        }
+    }
+
+    // ʵдǰ֮֡󣬼ĲۣۺʵδԵַ
+    void lowerPush(Lowering& L, IROperand o) {
+        int arg = L.pushed++;
+        if (o.kind() == IRO_SYM) {
+            bool global;
+            const Location* loc = find(L, L.fn->names[o.index()], global);
+            if (loc && loc->aggregate()) {
+                L.frameFixups.push_back(static_cast<int>(code.size()));
+                if (loc->kind == LOC_POINTER) emit(BCInst(BC_MOV, arg, loc->slot));
+                else if (global) emit(BCInst(BC_MOV, arg, constantSlot(L, loc->slot)));
+                else emit(BCInst(BC_ADDR, arg, loc->slot));
+                return;
+            }
+        }
+        int src = load(L, o, L.scratch[0]);
+        L.frameFixups.push_back(static_cast<int>(code.size()));
+        emit(BCInst(BC_MOV, arg, src));
+    }
+
+    void execute(long long* stack, CallRecord* calls) {
+        long long* const limit = stack + STACK_SLOTS;
+        const BCInst* const base = &code[0];
+        const BCFunction* fns = &functions[0];
+        long long* fp = stack;
+        int depth = 0;
+
+        const BCFunction& entry = fns[mainIndex];
+        if (entry.frameNeed > STACK_SLOTS) {
+            error = "stack overflow in main";
+            return;
+        }
+        if (!entry.initial.empty()) memcpy(fp + entry.params, &entry.initial[0], entry.initial.size() * sizeof(long long));
+        const BCInst* pc = base + entry.entry;
+
+#if defined(__GNUC__)
+        static void* const labels[BC_OPCODE_COUNT] = {
+            &&op_MOV, &&op_ADD, &&op_SUB, &&op_MUL, &&op_DIV,
+            &&op_GT, &&op_LT, &&op_GE, &&op_LE, &&op_EQ, &&op_NE,
+            &&op_LDG, &&op_STG, &&op_LDX, &&op_STX, &&op_LDXG, &&op_STXG, &&op_LDXP, &&op_STXP, &&op_ADDR,
+            &&op_JMP, &&op_JZ, &&op_JGT, &&op_JLT, &&op_JGE, &&op_JLE, &&op_JEQ, &&op_JNE,
+            &&op_CALL, &&op_RET
+        };
+#define VM_NEXT() goto *labels[pc->op]
+#define VM_OP(name) op_##name:
+        VM_NEXT();
+#else
+#define VM_NEXT() goto dispatch
+#define VM_OP(name) case BC_##name:
+    dispatch:
+        switch (pc->op) {
+#endif
+#define VM_BINARY(name, expr) VM_OP(name) fp[pc->a] = (expr); ++pc; VM_NEXT();
+#define VM_BRANCH(name, cond) VM_OP(name) pc = (cond) ? base + pc->a : pc + 1; VM_NEXT();
+#define VM_CHECK(index, length) \
+        if ((index) < 0 || ((length) >= 0 && (index) >= (length))) { error = "array index out of range"; return; }
+
+        VM_OP(MOV) fp[pc->a] = fp[pc->b]; ++pc; VM_NEXT();
+        VM_BINARY(ADD, fp[pc->b] + fp[pc->c])
+        VM_BINARY(SUB, fp[pc->b] - fp[pc->c])
+        VM_BINARY(MUL, fp[pc->b] * fp[pc->c])
+        VM_OP(DIV)
+            if (fp[pc->c] == 0) {
+                error = "division by zero";
+                return;
+            }
+            fp[pc->a] = fp[pc->b] / fp[pc->c];
+            ++pc;
+            VM_NEXT();
+        VM_BINARY(GT, fp[pc->b] > fp[pc->c])
+        VM_BINARY(LT, fp[pc->b] < fp[pc->c])
+        VM_BINARY(GE, fp[pc->b] >= fp[pc->c])
+        VM_BINARY(LE, fp[pc->b] <= fp[pc->c])
+        VM_BINARY(EQ, fp[pc->b] == fp[pc->c])
+        VM_BINARY(NE, fp[pc->b] != fp[pc->c])
+        VM_OP(LDG) fp[pc->a] = stack[pc->b]; ++pc; VM_NEXT();
+        VM_OP(STG) stack[pc->b] = fp[pc->a]; ++pc; VM_NEXT();
+        VM_OP(LDX) VM_CHECK(fp[pc->c], pc->d) fp[pc->a] = fp[pc->b + fp[pc->c]]; ++pc; VM_NEXT();
+        VM_OP(STX) VM_CHECK(fp[pc->c], pc->d) fp[pc->b + fp[pc->c]] = fp[pc->a]; ++pc; VM_NEXT();
+        VM_OP(LDXG) VM_CHECK(fp[pc->c], pc->d) fp[pc->a] = stack[pc->b + fp[pc->c]]; ++pc; VM_NEXT();
+        VM_OP(STXG) VM_CHECK(fp[pc->c], pc->d) stack[pc->b + fp[pc->c]] = fp[pc->a]; ++pc; VM_NEXT();
+        VM_OP(LDXP) {
+            long long addr = fp[pc->b] + fp[pc->c];
+            VM_CHECK(fp[pc->c], pc->d)
+            if (addr >= STACK_SLOTS) { error = "array index out of range"; return; }
+            fp[pc->a] = stack[addr];
+            ++pc;
+            VM_NEXT();
+        }
+        VM_OP(STXP) {
+            long long addr = fp[pc->b] + fp[pc->c];
+            VM_CHECK(fp[pc->c], pc->d)
+            if (addr >= STACK_SLOTS) { error = "array index out of range"; return; }
+            stack[addr] = fp[pc->a];
+            ++pc;
+            VM_NEXT();
+        }
+        VM_OP(ADDR) fp[pc->a] = (fp - stack) + pc->b; ++pc; VM_NEXT();
+        VM_OP(JMP) pc = base + pc->a; VM_NEXT();
+        VM_BRANCH(JZ, fp[pc->b] == 0)
+        VM_BRANCH(JGT, fp[pc->b] > fp[pc->c])
+        VM_BRANCH(JLT, fp[pc->b] < fp[pc->c])
+        VM_BRANCH(JGE, fp[pc->b] >= fp[pc->c])
+        VM_BRANCH(JLE, fp[pc->b] <= fp[pc->c])
+        VM_BRANCH(JEQ, fp[pc->b] == fp[pc->c])
+        VM_BRANCH(JNE, fp[pc->b] != fp[pc->c])
+        VM_OP(CALL) {
+            const BCFunction& callee = fns[pc->a];
+            long long* frame = fp + pc->b;
+            if (depth >= MAX_DEPTH || frame + callee.frameNeed > limit) {
+                error = "call stack overflow in " + callee.name;
+                return;
+            }
+            CallRecord& rec = calls[depth++];
+            rec.ret = pc + 1;
+            rec.fp = fp;
+            rec.dst = pc->c;
+            fp = frame;
+            if (!callee.initial.empty()) {
+                memcpy(fp + callee.params, &callee.initial[0], callee.initial.size() * sizeof(long long));
+            }
+            pc = base + callee.entry;
+            VM_NEXT();
+        }
+        VM_OP(RET) {
+            long long value = fp[pc->a];
+            if (depth == 0) {
+                result = value;
+                return;
+            }
+            const CallRecord& rec = calls[--depth];
+            fp = rec.fp;
+            if (rec.dst >= 0) fp[rec.dst] = value;
+            pc = rec.ret;
+            VM_NEXT();
+        }
+#if !defined(__GNUC__)
+        }
+#endif
+#undef VM_CHECK
+#undef VM_BRANCH
+#undef VM_BINARY
+#undef VM_OP
+#undef VM_NEXT
+    }
+};
+
+// ============================================================================
+// x86-64 ʱ
+//  BytecodeVM õֽ x86-64 룬Žִڴ
+// ֱӵ mainʡȥࡢӺģС֡ͬrbx ָ
+// ǰ֡rbp ָ JitContextrax/rcx/rdx/rdi ΪݴĴÿʹ
+// ıӳ䵽 r8~r15𱣴ԼõӳĴ
+// ֱӱΪ֮ call/ret ֱӵãֵ rax С
+// 㡢±Խջڣָʱ rsp 󷵻ش롣
+// ջǰһη䣬֡ڽ뺯ʱ㡣
+// ============================================================================
+struct JitContext {
+    long long* stack;       // ջףmain ֡
+    void* savedRsp;         // ڴ rspʱݴ˷
+    long long* limit;       // ջ
+    long long depth;        // ǰ
+    long long result;       // main ķֵ
+    long long callee;       // ջʱڵõĺ
+};
+
+class X86Jit {
+public:
+    string error;           // д󣬿ձʾ
+    long long result;
+
+    struct FunctionStats {
+        string name;
+        size_t bytecode;    // ָֽ
+        size_t bytes;       // ֽ
+        int registers;      // ӳ䵽ĴĲ
+        double ms;          // ʱ
+    };
+    vector<FunctionStats> stats;
+
+    explicit X86Jit(const BytecodeVM& vm) : result(0), source(vm), memory(NULL), memorySize(0), entryOffset(0) {
+        if (!vm.compileError.empty()) {
+            error = vm.compileError;
+            return;
+        }
+#if defined(__x86_64__) || defined(_M_X64)
+        compile();
+#else
+        error = "the JIT only supports x86-64 hosts";
+#endif
+    }
+
+    ~X86Jit() {
+        if (memory) {
+#ifdef _WIN32
+            VirtualFree(memory, 0, MEM_RELEASE);
+#else
+            munmap(memory, memorySize);
+#endif
+        }
+    }
+
+    size_t codeSize() const { return buf.size(); }
+
+    bool run() {
+        if (!error.empty()) {
+            return false;
+        }
+        const BytecodeVM::BCFunction& entry = source.functions[source.mainIndex];
+        if (entry.frameNeed > BytecodeVM::STACK_SLOTS) {
+            error = "stack overflow in main";
+            return false;
+        }
+        // ֡ڵʱ㣬ջҪʼ
+        unique_ptr<long long[]> stack(new long long[BytecodeVM::STACK_SLOTS]);
+        JitContext ctx;
+        ctx.stack = stack.get();
+        ctx.savedRsp = NULL;
+        ctx.limit = stack.get() + BytecodeVM::STACK_SLOTS;
+        ctx.depth = 0;
+        ctx.result = 0;
+        ctx.callee = source.mainIndex;
+
+        typedef long long (*EntryPoint)(JitContext*);
+        EntryPoint fn = reinterpret_cast<EntryPoint>(static_cast<uint8_t*>(memory) + entryOffset);
+        switch (fn(&ctx)) {
+        case ERR_NONE:
+            result = ctx.result;
+            break;
+        case ERR_DIVIDE:
+            error = "division by zero";
+            break;
+        case ERR_BOUNDS:
+            error = "array index out of range";
+            break;
+        default:
+            error = "call stack overflow in " + source.functions[ctx.callee].name;
+            break;
+        }
+        return error.empty();
+    }
+
+private:
+    enum Reg {
+        RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSP = 4, RBP = 5, RSI = 6, RDI = 7,
+        R8 = 8, R9, R10, R11, R12, R13, R14, R15
+    };
+
+    enum Cond {
+        CC_B = 0x2, CC_AE = 0x3, CC_E = 0x4, CC_NE = 0x5, CC_A = 0x7, CC_S = 0x8,
+        CC_L = 0xC, CC_GE = 0xD, CC_LE = 0xE, CC_G = 0xF
+    };
+
+    enum ErrorCode { ERR_NONE, ERR_DIVIDE, ERR_BOUNDS, ERR_STACK, ERR_COUNT };
+
+    static const int MAPPED_REGISTERS = 8;     // r8~r15
+
+    // ڴ [base + index*8 + disp]index Ϊ -1 ʾ
+    struct Mem {
+        int base;
+        int index;
+        int disp;
+
+        Mem(int b, int i, int d) : base(b), index(i), disp(d) {}
+    };
+
+    // ڵǰеλãӳĴ֡еڴ
+    struct Operand {
+        enum Kind { REG, IMM, MEM } kind;
+        int reg;
+        long long imm;
+        int disp;
+    };
+
+    struct Fixup {
+        size_t pos;         // rel32 λ
+        int target;         // ֽ±ꡢŻ
+    };
+
+    const BytecodeVM& source;
+    vector<uint8_t> buf;
+    void* memory;
+    size_t memorySize;
+    size_t entryOffset;
+
+    // ǰı״̬
+    const BytecodeVM::BCFunction* fn;
+    vector<int> slotReg;            // ӳ䵽ļĴ-1 ʾӳ
+    vector<int> savedRegs;
+    vector<size_t> bcOffset;        // ֽ±ӦĻλ
+    vector<Fixup> jumpFixups, callFixups, errorFixups, returnFixups;
+    vector<size_t> functionOffset;
+
+    // ---------------- ָ ----------------
+    void byte(int b) { buf.push_back(static_cast<uint8_t>(b)); }
+
+    void dword(long long v) {
+        uint32_t x = static_cast<uint32_t>(v);
+        for (int k = 0; k < 4; ++k) byte((x >> (8 * k)) & 0xFF);
+    }
+
+    void qword(long long v) {
+        uint64_t x = static_cast<uint64_t>(v);
+        for (int k = 0; k < 8; ++k) byte(static_cast<int>((x >> (8 * k)) & 0xFF));
+    }
+
+    static bool fitsInt32(long long v) {
+        return v >= -2147483647LL - 1 && v <= 2147483647LL;
+    }
+
+    void rex(bool w, int reg, int index, int base) {
+        int r = 0x40 | (w ? 8 : 0) | ((reg >> 3) & 1) << 2 | ((index >> 3) & 1) << 1 | ((base >> 3) & 1);
+        if (r != 0x40) byte(r);
+    }
+
+    // op reg, r/mĴʽ
+    void opRegReg(int op, int reg, int rm, bool w = true) {
+        rex(w, reg, 0, rm);
+        if (op > 0xFF) byte(op >> 8);
+        byte(op & 0xFF);
+        byte(0xC0 | (reg & 7) << 3 | (rm & 7));
+    }
+
+    // op reg, [mem]
+    void opRegMem(int op, int reg, const Mem& m) {
+        rex(true, reg, m.index < 0 ? 0 : m.index, m.base);
+        if (op > 0xFF) byte(op >> 8);
+        byte(op & 0xFF);
+        if (m.index < 0) {
+            byte(0x80 | (reg & 7) << 3 | (m.base & 7));
+        }
+        else {
+            byte(0x84 | (reg & 7) << 3);
+            byte(0xC0 | (m.index & 7) << 3 | (m.base & 7));
+        }
+        dword(m.disp);
+    }
+
+    // op r/m, imm32/ext ʽ
+    void opImmReg(int op, int ext, int rm, long long imm) {
+        rex(true, 0, 0, rm);
+        byte(op);
+        byte(0xC0 | ext << 3 | (rm & 7));
+        dword(imm);
+    }
+
+    void opImmMem(int op, int ext, const Mem& m, long long imm) {
+        opRegMem(op, ext, m);
+        dword(imm);
+    }
+
+    void movRegImm(int reg, long long imm) {
+        if (imm == 0) {
+            opRegReg(0x33, reg, reg, false);        // xor r32, r32
+        }
+        else if (fitsInt32(imm)) {
+            opImmReg(0xC7, 0, reg, imm);
+        }
+        else {
+            rex(true, 0, 0, reg);
+            byte(0xB8 | (reg & 7));
+            qword(imm);
+        }
+    }
+
+    void push(int reg) {
+        if (reg >= 8) byte(0x41);
+        byte(0x50 | (reg & 7));
+    }
+
+    void pop(int reg) {
+        if (reg >= 8) byte(0x41);
+        byte(0x58 | (reg & 7));
+    }
+
+    void jump(int opcode, vector<Fixup>& fixups, int target) {
+        if (opcode > 0xFF) byte(opcode >> 8);
+        byte(opcode & 0xFF);
+        Fixup f;
+        f.pos = buf.size();
+        f.target = target;
+        fixups.push_back(f);
+        dword(0);
+    }
+
+    void jcc(int cc, vector<Fixup>& fixups, int target) {
+        jump(0x0F80 | cc, fixups, target);
+    }
+
+    void patch(size_t pos, size_t target) {
+        long long rel = static_cast<long long>(target) - static_cast<long long>(pos + 4);
+        uint32_t x = static_cast<uint32_t>(rel);
+        for (int k = 0; k < 4; ++k) buf[pos + k] = static_cast<uint8_t>((x >> (8 * k)) & 0xFF);
+    }
+
+    // ---------------- ۵Ķд ----------------
+    Operand operand(int slot) const {
+        Operand o;
+        o.reg = -1;
+        o.imm = 0;
+        o.disp = slot * 8;
+        if (slot < static_cast<int>(slotReg.size()) && slotReg[slot] >= 0) {
+            o.kind = Operand::REG;
+            o.reg = slotReg[slot];
+        }
+        else if (slot < fn->frameSize && fn->slotKinds[slot] == BytecodeVM::SLOT_CONSTANT) {
+            o.kind = Operand::IMM;
+            o.imm = fn->initial[slot - fn->params];
+        }
+        else {
+            o.kind = Operand::MEM;
+        }
+        return o;
+    }
+
+    void load(int reg, int slot) {
+        Operand o = operand(slot);
+        if (o.kind == Operand::REG) {
+            if (o.reg != reg) opRegReg(0x8B, reg, o.reg);
+        }
+        else if (o.kind == Operand::IMM) {
+            movRegImm(reg, o.imm);
+        }
+        else {
+            opRegMem(0x8B, reg, Mem(RBX, -1, o.disp));
+        }
+    }
+
+    void store(int slot, int reg) {
+        Operand o = operand(slot);
+        if (o.kind == Operand::REG) {
+            if (o.reg != reg) opRegReg(0x8B, o.reg, reg);
+        }
+        else {
+            opRegMem(0x89, reg, Mem(RBX, -1, o.disp));
+        }
+    }
+
+    // reg = reg op ۣop Ϊ add/sub/cmp/imul ֮һ
+    void alu(int op, int reg, int slot) {
+        Operand o = operand(slot);
+        if (o.kind == Operand::IMM && fitsInt32(o.imm)) {
+            if (op == 0x0FAF) {
+                rex(true, reg, 0, reg);
+                byte(0x69);
+                byte(0xC0 | (reg & 7) << 3 | (reg & 7));
+                dword(o.imm);
+            }
+            else {
+                opImmReg(0x81, op == 0x03 ? 0 : op == 0x2B ? 5 : 7, reg, o.imm);
+            }
+        }
+        else if (o.kind == Operand::IMM) {
+            movRegImm(RDX, o.imm);
+            opRegReg(op, reg, RDX);
+        }
+        else if (o.kind == Operand::REG) {
+            opRegReg(op, reg, o.reg);
+        }
+        else {
+            opRegMem(op, reg, Mem(RBX, -1, o.disp));
+        }
+    }
+
+    // ± rcx Уlength Ϊ -1 ʱֻǸ
+    void boundsCheck(int length) {
+        if (length > 0) {
+            opImmReg(0x81, 7, RCX, length);
+            jcc(CC_AE, errorFixups, ERR_BOUNDS);
+        }
+        else {
+            opRegReg(0x85, RCX, RCX);
+            jcc(CC_S, errorFixups, ERR_BOUNDS);
+        }
+    }
+
+    // ---------------- Ĵ ----------------
+    // ֽгֵĴѡۣᰴַ main ıʱ main ӳ
+    void allocateRegisters(int id, int begin, int end, bool globalsShared) {
+        slotReg.assign(fn->frameSize, -1);
+        savedRegs.clear();
+        if (id == source.mainIndex && globalsShared) return;
+
+        vector<int> uses(fn->frameSize, 0);
+        for (int k = begin; k < end; ++k) {
+            const BCInst& inst = source.code[k];
+            int fields = slotFields(inst.op);
+            int operands[3] = { inst.a, inst.b, inst.c };
+            for (int f = 0; f < 3; ++f) {
+                int slot = operands[f];
+                if ((fields >> f & 1) && slot >= 0 && slot < fn->frameSize) uses[slot]++;
+            }
+        }
+        vector<pair<int, int> > order;
+        for (int slot = 0; slot < fn->frameSize; ++slot) {
+            if (fn->slotKinds[slot] == BytecodeVM::SLOT_VALUE && uses[slot] >= 2) {
+                order.push_back(make_pair(-uses[slot], slot));
+            }
+        }
+        sort(order.begin(), order.end());
+        for (size_t k = 0; k < order.size() && k < static_cast<size_t>(MAPPED_REGISTERS); ++k) {
+            int reg = R8 + static_cast<int>(k);
+            slotReg[order[k].second] = reg;
+            savedRegs.push_back(reg);
+        }
+    }
+
+    // ָ a/b/c ֶЩǵǰ֡Ĳۣλ0~2
+    static int slotFields(int op) {
+        switch (op) {
+        case BC_MOV: return 3;
+        case BC_LDG: case BC_STG: case BC_ADDR: case BC_RET: return 1;
+        case BC_LDX: case BC_STX: case BC_LDXG: case BC_STXG: return 5;
+        case BC_LDXP: case BC_STXP: return 7;
+        case BC_JMP: return 0;
+        case BC_JZ: return 2;
+        case BC_CALL: return 4;
+        case BC_JGT: case BC_JLT: case BC_JGE: case BC_JLE: case BC_JEQ: case BC_JNE: return 6;
+        default: return 7;
+        }
+    }
+
+    // ----------------  ----------------
+    void compile() {
+        const vector<BytecodeVM::BCFunction>& functions = source.functions;
+        bool globalsShared = false;
+        for (size_t k = 0; k < source.code.size(); ++k) {
+            int op = source.code[k].op;
+            if (op == BC_LDG || op == BC_STG || op == BC_LDXG || op == BC_STXG) globalsShared = true;
+        }
+
+        bcOffset.assign(source.code.size(), 0);
+        functionOffset.assign(functions.size(), 0);
+        for (size_t id = 0; id < functions.size(); ++id) {
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            size_t before = buf.size();
+            int begin = functions[id].entry;
+            int end = id + 1 < functions.size() ? functions[id + 1].entry : static_cast<int>(source.code.size());
+            fn = &functions[id];
+            allocateRegisters(static_cast<int>(id), begin, end, globalsShared);
+            functionOffset[id] = buf.size();
+            compileFunction(begin, end);
+
+            FunctionStats s;
+            s.name = fn->name;
+            s.bytecode = end - begin;
+            s.bytes = buf.size() - before;
+            s.registers = static_cast<int>(savedRegs.size());
+            s.ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            stats.push_back(s);
+        }
+
+        vector<size_t> errorOffset(ERR_COUNT + functions.size());
+        compileEntry(errorOffset);
+
+        for (size_t k = 0; k < callFixups.size(); ++k) {
+            patch(callFixups[k].pos, functionOffset[callFixups[k].target]);
+        }
+        for (size_t k = 0; k < errorFixups.size(); ++k) {
+            patch(errorFixups[k].pos, errorOffset[errorFixups[k].target]);
+        }
+        install();
+    }
+
+    void compileFunction(int begin, int end) {
+        for (size_t k = 0; k < savedRegs.size(); ++k) push(savedRegs[k]);
+
+        // ֮Ĳ㣨ӳĴĲ۲ڴȡ
+        int zeroSlots = 0;
+        for (int slot = fn->params; slot < fn->frameSize; ++slot) {
+            if (fn->slotKinds[slot] != BytecodeVM::SLOT_CONSTANT && slotReg[slot] < 0) zeroSlots++;
+        }
+        if (zeroSlots > 16) {
+            opRegMem(0x8D, RDI, Mem(RBX, -1, fn->params * 8));     // lea rdi, [rbx + params*8]
+            movRegImm(RCX, fn->frameSize - fn->params);
+            opRegReg(0x33, RAX, RAX, false);
+            byte(0xF3); byte(0x48); byte(0xAB);                     // rep stosq
+        }
+        else {
+            for (int slot = fn->params; slot < fn->frameSize; ++slot) {
+                if (fn->slotKinds[slot] != BytecodeVM::SLOT_CONSTANT && slotReg[slot] < 0) {
+                    opImmMem(0xC7, 0, Mem(RBX, -1, slot * 8), 0);
+                }
+            }
+        }
+        for (int slot = 0; slot < fn->frameSize; ++slot) {
+            if (slotReg[slot] < 0) continue;
+            if (slot < fn->params) opRegMem(0x8B, slotReg[slot], Mem(RBX, -1, slot * 8));
+            else movRegImm(slotReg[slot], 0);
+        }
+
+        jumpFixups.clear();
+        returnFixups.clear();
+        for (int k = begin; k < end; ++k) {
+            bcOffset[k] = buf.size();
+            compileInst(source.code[k]);
+        }
+
+        size_t epilogue = buf.size();
+        for (size_t k = savedRegs.size(); k-- > 0;) pop(savedRegs[k]);
+        byte(0xC3);
+
+        for (size_t k = 0; k < jumpFixups.size(); ++k) {
+            patch(jumpFixups[k].pos, bcOffset[jumpFixups[k].target]);
+        }
+        for (size_t k = 0; k < returnFixups.size(); ++k) {
+            patch(returnFixups[k].pos, epilogue);
+        }
+    }
+
+    static int branchCond(int op) {
+        switch (op) {
+        case BC_JGT: case BC_GT: return CC_G;
+        case BC_JLT: case BC_LT: return CC_L;
+        case BC_JGE: case BC_GE: return CC_GE;
+        case BC_JLE: case BC_LE: return CC_LE;
+        case BC_JEQ: case BC_EQ: return CC_E;
+        default: return CC_NE;
+        }
+    }
+
+    void compileInst(const BCInst& inst) {
+        switch (inst.op) {
+        case BC_MOV: {
+            Operand dst = operand(inst.a);
+            if (dst.kind == Operand::REG) {
+                load(dst.reg, inst.b);
+            }
+            else {
+                load(RAX, inst.b);
+                store(inst.a, RAX);
+            }
+            break;
+        }
+        case BC_ADD: case BC_SUB: case BC_MUL: {
+            Operand dst = operand(inst.a);
+            int reg = dst.kind == Operand::REG && inst.a != inst.c ? dst.reg : RAX;
+            load(reg, inst.b);
+            alu(inst.op == BC_ADD ? 0x03 : inst.op == BC_SUB ? 0x2B : 0x0FAF, reg, inst.c);
+            if (reg == RAX) store(inst.a, RAX);
+            break;
+        }
+        case BC_DIV:
+            load(RCX, inst.c);
+            opRegReg(0x85, RCX, RCX);
+            jcc(CC_E, errorFixups, ERR_DIVIDE);
+            load(RAX, inst.b);
+            byte(0x48); byte(0x99);                                 // cqo
+            opRegReg(0xF7, 7, RCX);                                 // idiv rcx
+            store(inst.a, RAX);
+            break;
+        case BC_GT: case BC_LT: case BC_GE: case BC_LE: case BC_EQ: case BC_NE:
+            load(RAX, inst.b);
+            alu(0x3B, RAX, inst.c);
+            byte(0x0F); byte(0x90 | branchCond(inst.op)); byte(0xC0);   // setcc al
+            byte(0x0F); byte(0xB6); byte(0xC0);                         // movzx eax, al
+            store(inst.a, RAX);
+            break;
+        case BC_LDG:
+            opRegMem(0x8B, RDX, Mem(RBP, -1, offsetof(JitContext, stack)));
+            opRegMem(0x8B, RAX, Mem(RDX, -1, inst.b * 8));
+            store(inst.a, RAX);
+            break;
+        case BC_STG:
+            opRegMem(0x8B, RDX, Mem(RBP, -1, offsetof(JitContext, stack)));
+            load(RAX, inst.a);
+            opRegMem(0x89, RAX, Mem(RDX, -1, inst.b * 8));
+            break;
+        case BC_LDX: case BC_LDXG:
+            load(RCX, inst.c);
+            boundsCheck(inst.d);
+            if (inst.op == BC_LDXG) opRegMem(0x8B, RDX, Mem(RBP, -1, offsetof(JitContext, stack)));
+            opRegMem(0x8B, RAX, Mem(inst.op == BC_LDX ? RBX : RDX, RCX, inst.b * 8));
+            store(inst.a, RAX);
+            break;
+        case BC_STX: case BC_STXG:
+            load(RCX, inst.c);
+            boundsCheck(inst.d);
+            if (inst.op == BC_STXG) opRegMem(0x8B, RDX, Mem(RBP, -1, offsetof(JitContext, stack)));
+            load(RAX, inst.a);
+            opRegMem(0x89, RAX, Mem(inst.op == BC_STX ? RBX : RDX, RCX, inst.b * 8));
+            break;
+        case BC_LDXP: case BC_STXP:
+            load(RCX, inst.c);
+            boundsCheck(inst.d);
+            load(RDX, inst.b);
+            opRegReg(0x03, RDX, RCX);                               // rdx = Բۺ
+            opImmReg(0x81, 7, RDX, BytecodeVM::STACK_SLOTS);
+            jcc(CC_AE, errorFixups, ERR_BOUNDS);
+            opRegMem(0x8B, RCX, Mem(RBP, -1, offsetof(JitContext, stack)));
+            if (inst.op == BC_LDXP) {
+                opRegMem(0x8B, RAX, Mem(RCX, RDX, 0));
+                store(inst.a, RAX);
+            }
+            else {
+                load(RAX, inst.a);
+                opRegMem(0x89, RAX, Mem(RCX, RDX, 0));
+            }
+            break;
+        case BC_ADDR:
+            opRegReg(0x8B, RAX, RBX);
+            opRegMem(0x2B, RAX, Mem(RBP, -1, offsetof(JitContext, stack)));
+            byte(0x48); byte(0xC1); byte(0xF8); byte(0x03);         // sar rax, 3
+            opImmReg(0x81, 0, RAX, inst.b);
+            store(inst.a, RAX);
+            break;
+        case BC_JMP:
+            jump(0xE9, jumpFixups, inst.a);
+            break;
+        case BC_JZ: {
+            Operand o = operand(inst.b);
+            if (o.kind == Operand::IMM) {
+                if (o.imm == 0) jump(0xE9, jumpFixups, inst.a);
+                break;
+            }
+            if (o.kind == Operand::REG) opRegReg(0x85, o.reg, o.reg);
+            else opImmMem(0x81, 7, Mem(RBX, -1, o.disp), 0);
+            jcc(CC_E, jumpFixups, inst.a);
+            break;
+        }
+        case BC_JGT: case BC_JLT: case BC_JGE: case BC_JLE: case BC_JEQ: case BC_JNE: {
+            Operand x = operand(inst.b);
+            int reg = x.kind == Operand::REG ? x.reg : RAX;
+            if (reg == RAX) load(RAX, inst.b);
+            alu(0x3B, reg, inst.c);
+            jcc(branchCond(inst.op), jumpFixups, inst.a);
+            break;
+        }
+        case BC_CALL: {
+            const BytecodeVM::BCFunction& callee = source.functions[inst.a];
+            opRegMem(0x8D, RAX, Mem(RBX, -1, (inst.b + callee.frameNeed) * 8));
+            opRegMem(0x3B, RAX, Mem(RBP, -1, offsetof(JitContext, limit)));
+            jcc(CC_A, errorFixups, ERR_COUNT + inst.a);
+            opRegMem(0xFF, 0, Mem(RBP, -1, offsetof(JitContext, depth)));          // inc depth
+            opImmMem(0x81, 7, Mem(RBP, -1, offsetof(JitContext, depth)), BytecodeVM::MAX_DEPTH);
+            jcc(CC_A, errorFixups, ERR_COUNT + inst.a);
+            opImmReg(0x81, 0, RBX, inst.b * 8);
+            jump(0xE8, callFixups, inst.a);
+            opImmReg(0x81, 5, RBX, inst.b * 8);
+            opRegMem(0xFF, 1, Mem(RBP, -1, offsetof(JitContext, depth)));          // dec depth
+            if (inst.c >= 0) store(inst.c, RAX);
+            break;
+        }
+        case BC_RET:
+            load(RAX, inst.a);
+            jump(0xE9, returnFixups, 0);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // ڣlong long entry(JitContext*)汻߱ļĴ main
+    // ڻָʱ rsp 󷵻ش
+    void compileEntry(vector<size_t>& errorOffset) {
+        static const int saved[] = { RBX, RBP, R12, R13, R14, R15, RDI, RSI };
+        const int savedCount = sizeof(saved) / sizeof(saved[0]);
+
+        entryOffset = buf.size();
+        for (int k = 0; k < savedCount; ++k) push(saved[k]);
+        opImmReg(0x81, 5, RSP, 8);                                  // 16ֽڶ
+#ifdef _WIN32
+        opRegReg(0x8B, RBP, RCX);
+#else
+        opRegReg(0x8B, RBP, RDI);
+#endif
+        opRegMem(0x89, RSP, Mem(RBP, -1, offsetof(JitContext, savedRsp)));
+        opRegMem(0x8B, RBX, Mem(RBP, -1, offsetof(JitContext, stack)));
+        jump(0xE8, callFixups, source.mainIndex);
+        opRegMem(0x89, RAX, Mem(RBP, -1, offsetof(JitContext, result)));
+        opRegReg(0x33, RAX, RAX, false);
+        size_t exit = buf.size();
+        opImmReg(0x81, 0, RSP, 8);
+        for (int k = savedCount; k-- > 0;) pop(saved[k]);
+        byte(0xC3);
+
+        size_t errorExit = buf.size();
+        opRegMem(0x8B, RSP, Mem(RBP, -1, offsetof(JitContext, savedRsp)));
+        byte(0xE9);
+        dword(0);
+        patch(buf.size() - 4, exit);
+
+        errorOffset[ERR_NONE] = exit;
+        for (int code = ERR_DIVIDE; code < ERR_COUNT; ++code) {
+            errorOffset[code] = buf.size();
+            movRegImm(RAX, code);
+            byte(0xE9);
+            dword(0);
+            patch(buf.size() - 4, errorExit);
+        }
+        // ջȼ± ERR_COUNT + ţ
+        for (size_t id = 0; id < source.functions.size(); ++id) {
+            errorOffset[ERR_COUNT + id] = buf.size();
+            opImmMem(0xC7, 0, Mem(RBP, -1, offsetof(JitContext, callee)), static_cast<long long>(id));
+            byte(0xE9);
+            dword(0);
+            patch(buf.size() - 4, errorOffset[ERR_STACK]);
+        }
+    }
+
+    // ƵӳڴΪִֻ
+    void install() {
+#ifdef _WIN32
+        memorySize = buf.size();
+        memory = VirtualAlloc(NULL, memorySize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+        if (!memory) {
+            error = "cannot allocate executable memory";
+            return;
+        }
+        memcpy(memory, &buf[0], buf.size());
+        DWORD old;
+        if (!VirtualProtect(memory, memorySize, PAGE_EXECUTE_READ, &old)) {
+            error = "cannot make JIT code executable";
+        }
+#else
+        long page = sysconf(_SC_PAGESIZE);
+        memorySize = (buf.size() + page - 1) / page * page;
+        void* p = mmap(NULL, memorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            error = "cannot allocate executable memory";
+            return;
+        }
+        memory = p;
+        memcpy(memory, &buf[0], buf.size());
+        if (mprotect(memory, memorySize, PROT_READ | PROT_EXEC) != 0) {
+            error = "cannot make JIT code executable";
+        }
+#endif
+    }
+};
+
+// ============================================================================
+// 嶯
+// ķغÿ @ űԤȱɶö٣
+// genQt ͨԱָɣڷбȽַ
+// ============================================================================
+enum SemAction {
+    ACT_NONE,           // δʶĶ
+    ACT_PUSH_VAL,
+    ACT_PUSH_ID,
+    ACT_PUSH_NUM,
+    ACT_SAVE,           // @SAVE_XXѹջ
+    ACT_GEQ_G,          // ջԪʽ
+    ACT_GEQ_MARKER,     // @GEQ_break/continue/el/ie/wh/we޲ıԪʽ
+    ACT_GEQ_C1,         // зֵĺ
+    ACT_GEQ_C2,         // ޷ֵĺ
+    ACT_COUNT
+};
+
+enum SemOp {
+    SOP_UNKNOWN,
+    SOP_FUN,
+    SOP_ASSIGN, SOP_ADD_ASSIGN, SOP_SUB_ASSIGN, SOP_MUL_ASSIGN, SOP_DIV_ASSIGN,
+    SOP_PRE_INC, SOP_PRE_DEC, SOP_POST_INC, SOP_POST_DEC,
+    SOP_ADD, SOP_SUB, SOP_MUL, SOP_DIV,
+    SOP_GT, SOP_LT, SOP_GE, SOP_LE, SOP_EQ, SOP_NE,
+    SOP_RETURN, SOP_IF, SOP_ELIF, SOP_DO, SOP_PUSH, SOP_CALL, SOP_CALLR,
+    SOP_COUNT
+};
+
+// ķ@SAVE_XԪʽед
+static const char* const SEM_OP_NAMES[SOP_COUNT] = {
+    "", "FUN", "=", "+=", "-=", "*=", "/=", "++", "--", "p++", "p--",
+    "+", "-", "*", "/", ">", "<", ">=", "<=", "==", "!=",
+    "return", "if", "elif", "do", "push", "call", "callr"
+};
+
+// ============================================================================
+// QtGen class (ȫƵԪʽ)
+// ============================================================================
+class QtGen : public GrammarParser {
+private:
+    SYMBOL* syn_table;
+    vector<IRFunction*> ir_res;     // ÿһӵArena
+
+    // ķţŸ롢ͺ׺ı
+    struct GrammarSymbol {
+        string name;
+        bool isAction;
+        SemAction action;
+        SemOp op;
+        string text;    // @SAVE_/@GEQ_ Ĳ
+    };
+
+    // genQt еջƥսʱֱӰֵƥʷ
+    struct GenState {
+        string lastVal;               // ƥս
+        string lastId;                // ƥıʶ
+        string lastNum;               // ƥĳ
+        vector<SemOp> SYMBOL_STACK;   // ջ
+        vector<string> SEM_STACK;     // ջ
+        vector<Quaternion> qtList;
+        int t_id;                     // ʱţÿ0ʼ
+        GenState() : t_id(0) {}
+    };
+
+    typedef void (QtGen::*ActionHandler)(const GrammarSymbol& sym, GenState& st) const;
+
+    vector<GrammarSymbol> symbols;
+    map<string, int> symbolIds;
+    vector<vector<int> > productions;   // ʽҲķidղʽΪ
+    ActionHandler handlers[ACT_COUNT];
+    int startSymbol;    // ķʼŵid
+    int endSymbol;      //  # id
+
+protected:
+    virtual string getAnalysisTableName() {
+        return "TranslationAnalysisTable.txt";
+    }
+
+public:
+    QtGen(SYMBOL* syn, const string& grammarPath = "")
+        : GrammarParser(grammarPath), syn_table(syn), startSymbol(0), endSymbol(0) {
+        cout << "[DEBUG] QtGen constructor called" << endl;
+
+        // ûṩķ·ʹĬϵķķ
+        if (grammarPath.empty()) {
+            loadEmbeddedTranslationGrammar();
+        }
+
+        // 
+        initList();
+
+        // Ԥ嶯
+        compileActions();
+    }
+
+    ~QtGen() {
+        IRAdapter::release(ir_res);
+    }
+
+    // ȡɵIRȨתƸߣ֮ IRAdapter::release ͷţ
+    vector<IRFunction*> takeIR() {
+        vector<IRFunction*> res;
+        res.swap(ir_res);
+        return res;
+    }
+
+    // Ԫʽ
+    void genQt(const vector<Token>& funcBlock) {
+        ir_res.push_back(translate(funcBlock));
+    }
+
+    // 鲢Ԫʽ˳׷ӣظĵ
+    vector<string> genQtParallel(const vector<vector<Token> >& funcBlocks, ThreadPool& pool) {
+        size_t base = ir_res.size();
+        ir_res.resize(base + funcBlocks.size(), NULL);
+        return pool.run(funcBlocks.size(), [&](size_t i) {
+            ir_res[base + i] = translate(funcBlocks[i]);
+        });
+    }
+
+    // ӡԪʽ
+    void printQuaternions() {
+        cout << "\n=== Quaternions ===" << endl;
+        for (size_t i = 0; i < ir_res.size(); ++i) {
+            cout << "Function " << i << ":" << endl;
+            const IRFunction& fn = *ir_res[i];
+            for (size_t j = 0; j < fn.code.size(); ++j) {
+                Quaternion q = IRAdapter::decode(fn, fn.code[j]);
+                cout << "  [" << j << "] (" << q.op << ", "
+                    << q.arg1 << ", " << q.arg2 << ", "
+                    << q.result << ")" << endl;
+            }
+        }
+    }
+
+private:
+    // һ顣ֻȡķͷűпɱ״̬ GenState У
+    // ˲ͬڲͬ߳ͬʱ
+    IRFunction* translate(const vector<Token>& funcBlock) const {
+        dbgOut() << "[DEBUG] QtGen::genQt - Generating quaternions for function block" << endl;
+
+        GenState st;
+        vector<int> SYN;              // ﷨ջķid
+
+        SYN.push_back(endSymbol);
+        SYN.push_back(startSymbol);
+
+        // ֮ǽ #ֱӰ±ȡtokenб
+        Token endToken("p", 0, "#", 0, static_cast<int>(funcBlock.size()));
+
+        size_t tokenIndex = 0;
+        const Token* token = funcBlock.empty() ? &endToken : &funcBlock[tokenIndex];
+        tokenIndex++;
+        string w = getTokenVal(*token);
+
+        while (!SYN.empty()) {
+            const GrammarSymbol& sym = symbols[SYN.back()];
+            SYN.pop_back();
+            const string& x = sym.name;
+
+            dbgOut() << "[DEBUG] Stack top: " << x << ", Current token: " << w << " (val: " << token->val << ")" << endl;
+
+            // 嶯
+            if (sym.isAction) {
+                dbgOut() << "[DEBUG] Semantic action: " << x << endl;
+                (this->*handlers[sym.action])(sym, st);
+                continue;
+            }
+
+            if (x != w) {
+                // xǷսҲʽ
+                if (VN.find(x) != VN.end()) {
+                    map<string, map<string, int> >::const_iterator row = analysis_table.find(x);
+                    map<string, int>::const_iterator cell;
+                    if (row != analysis_table.end() &&
+                        (cell = row->second.find(w)) != row->second.end()) {
+
+                        int id = cell->second;
+                        if (id >= 0 && id < static_cast<int>(P_LIST.size())) {
+                            const vector<int>& tmp = productions[id];
+
+                            dbgOut() << "[DEBUG] Using production " << id << ": " << x << " -> ";
+                            for (size_t i = 0; i < P_LIST[id].second.size(); ++i) {
+                                dbgOut() << P_LIST[id].second[i] << " ";
+                            }
+                            dbgOut() << endl;
+
+                            // ѹջ
+                            for (int i = static_cast<int>(tmp.size()) - 1; i >= 0; --i) {
+                                SYN.push_back(tmp[i]);
+                            }
+                        }
+                        else {
+                            dbgOut() << "[ERROR] Invalid production id: " << id << endl;
+                        }
+                    }
+                    else {
+                        dbgOut() << "[ERROR] No entry in analysis table for " << x << " with " << w << endl;
+                    }
+                }
+                else {
+                    dbgOut() << "[ERROR] Expected " << x << " but got " << w << endl;
+                }
+            }
+            else {
+                // ƥɹ
+                dbgOut() << "[DEBUG] Matched: " << x << " with token: " << token->val << endl;
+
+                // ֵ@PUSH_* ֱȡ
+                st.lastVal = token->val;
+                if (token->type == "i") {
+                    st.lastId = token->val;
+                }
+                else if (w == "NUM") {
+                    st.lastNum = token->val;
+                }
+
+                if (w == "#") {
+                    dbgOut() << "[DEBUG] Analysis completed" << endl;
+                    break;
+                }
+
+                if (tokenIndex < funcBlock.size()) {
+                    token = &funcBlock[tokenIndex++];
+                    w = getTokenVal(*token);
+                }
+                else if (tokenIndex == funcBlock.size()) {
+                    token = &endToken;
+                    tokenIndex++;
+                    w = "#";
+                }
+                else {
+                    w = "#";
+                }
+            }
+        }
+
+        dbgOut() << "[DEBUG] Generated " << st.qtList.size() << " quaternions" << endl;
+        return IRAdapter::fromQuaternions(st.qtList);
+    }
+
+
+    // ȡTokenֵ﷨
+    string getTokenVal(const Token& token) const {
+        // Ƿǽṹ
+        if (find(syn_table->structNameList.begin(),
+            syn_table->structNameList.end(),
+            token.val) != syn_table->structNameList.end()) {
+            return "st";
+        }
+
+        // гͳһӳΪ NUM LL1::getTokenVal һ£
+        if (token.type == "int_con" || token.type == "float_con" || token.type == "char_con") {
+            return "NUM";
+        }
+
+        if (token.type == "i") {
             return "ID";
         }
 
@@ -2263,227 +7048,259 @@ private:
         return token.val;
     }
 
-    // Ƶ嶯
-    void catchAction(const string& x, vector<Token>& MATCHED_TOKENS,
-        vector<string>& SYMBOL_STACK,
-        vector<string>& SEM_STACK,
-        vector<Quaternion>& qtList) {
+    // ķűţ״γʱǼ
+    int symbolId(const string& name) {
+        map<string, int>::const_iterator it = symbolIds.find(name);
+        if (it != symbolIds.end()) {
+            return it->second;
+        }
 
-        cout << "[DEBUG] Semantic action: " << x << endl;
+        GrammarSymbol sym;
+        sym.name = name;
+        sym.isAction = !name.empty() && name[0] == '@';
+        sym.action = ACT_NONE;
+        sym.op = SOP_UNKNOWN;
 
-        //  @PUSH_VAL
-        if (x == "@PUSH_VAL") {
-            // ƥtokenջлȡƥtoken
-            if (!MATCHED_TOKENS.empty()) {
-                Token lastMatched = MATCHED_TOKENS.back();
-                SEM_STACK.push_back(lastMatched.val);
-                cout << "[DEBUG] Pushed to SEM_STACK: " << lastMatched.val << endl;
+        if (sym.isAction) {
+            if (name == "@PUSH_VAL") {
+                sym.action = ACT_PUSH_VAL;
+            }
+            else if (name == "@PUSH_ID") {
+                sym.action = ACT_PUSH_ID;
+            }
+            else if (name == "@PUSH_NUM") {
+                sym.action = ACT_PUSH_NUM;
+            }
+            else if (name.find("@SAVE_") == 0) {
+                sym.action = ACT_SAVE;
+                sym.text = name.substr(6);
+                sym.op = semOpOf(sym.text);
+            }
+            else if (name.find("@GEQ_") == 0) {
+                sym.text = name.substr(5);
+                if (sym.text == "G") {
+                    sym.action = ACT_GEQ_G;
+                }
+                else if (sym.text == "c1") {
+                    sym.action = ACT_GEQ_C1;
+                }
+                else if (sym.text == "c2") {
+                    sym.action = ACT_GEQ_C2;
+                }
+                else if (sym.text == "break" || sym.text == "continue" || sym.text == "el" ||
+                    sym.text == "ie" || sym.text == "wh" || sym.text == "we") {
+                    sym.action = ACT_GEQ_MARKER;
+                }
             }
-            return;
         }
 
-        //  @PUSH_ID - ƥID token
-        if (x == "@PUSH_ID") {
-            // ӺǰID token
-            for (int i = static_cast<int>(MATCHED_TOKENS.size()) - 1; i >= 0; --i) {
-                if (MATCHED_TOKENS[i].type == "i") {
-                    SEM_STACK.push_back(MATCHED_TOKENS[i].val);
-                    cout << "[DEBUG] Pushed ID to SEM_STACK: " << MATCHED_TOKENS[i].val << endl;
-                    break;
-                }
+        int id = static_cast<int>(symbols.size());
+        symbols.push_back(sym);
+        symbolIds[name] = id;
+        return id;
+    }
+
+    static SemOp semOpOf(const string& text) {
+        for (int i = SOP_FUN; i < SOP_COUNT; ++i) {
+            if (text == SEM_OP_NAMES[i]) {
+                return static_cast<SemOp>(i);
             }
-            return;
         }
+        return SOP_UNKNOWN;
+    }
 
-        //  @PUSH_NUM - ƥNUM token
-        if (x == "@PUSH_NUM") {
-            // ӺǰNUM token
-            for (int i = static_cast<int>(MATCHED_TOKENS.size()) - 1; i >= 0; --i) {
-                if (MATCHED_TOKENS[i].type == "con") {
-                    SEM_STACK.push_back(MATCHED_TOKENS[i].val);
-                    cout << "[DEBUG] Pushed NUM to SEM_STACK: " << MATCHED_TOKENS[i].val << endl;
-                    break;
+    // ķغִһΣʽҲתΪidŽΪ
+    void compileActions() {
+        handlers[ACT_NONE] = &QtGen::actNone;
+        handlers[ACT_PUSH_VAL] = &QtGen::actPushVal;
+        handlers[ACT_PUSH_ID] = &QtGen::actPushId;
+        handlers[ACT_PUSH_NUM] = &QtGen::actPushNum;
+        handlers[ACT_SAVE] = &QtGen::actSave;
+        handlers[ACT_GEQ_G] = &QtGen::actGeqG;
+        handlers[ACT_GEQ_MARKER] = &QtGen::actGeqMarker;
+        handlers[ACT_GEQ_C1] = &QtGen::actGeqC1;
+        handlers[ACT_GEQ_C2] = &QtGen::actGeqC2;
+
+        productions.clear();
+        for (size_t i = 0; i < P_LIST.size(); ++i) {
+            const vector<string>& right = P_LIST[i].second;
+            vector<int> ids;
+            if (!(right.size() == 1 && right[0] == "$")) {
+                for (size_t j = 0; j < right.size(); ++j) {
+                    ids.push_back(symbolId(right[j]));
                 }
             }
-            return;
+            productions.push_back(ids);
         }
+        endSymbol = symbolId("#");
+        startSymbol = symbolId(Z);
+    }
 
-        //  @SAVE_X ʽ
-        if (x.find("@SAVE_") == 0) {
-            string symbol = x.substr(6);  // ȡ @SAVE_ ķ
-            SYMBOL_STACK.push_back(symbol);
-            cout << "[DEBUG] Pushed to SYMBOL_STACK: " << symbol << endl;
-            return;
-        }
+    static string newTemp(GenState& st) {
+        stringstream ss;
+        ss << "@t" << st.t_id++;
+        return ss.str();
+    }
 
-        //  @GEQ_X ʽ
-        if (x.find("@GEQ_") == 0) {
-            string action = x.substr(5);  // ȡ @GEQ_ Ķ
+    void actNone(const GrammarSymbol&, GenState&) const {
+    }
 
-            if (action == "G") {
-                // ͨԪʽ
-                if (!SYMBOL_STACK.empty()) {
-                    string op = SYMBOL_STACK.back();
-                    SYMBOL_STACK.pop_back();
+    //  @PUSH_VAL - ƥtoken
+    void actPushVal(const GrammarSymbol&, GenState& st) const {
+        st.SEM_STACK.push_back(st.lastVal);
+        dbgOut() << "[DEBUG] Pushed to SEM_STACK: " << st.lastVal << endl;
+    }
 
-                    cout << "[DEBUG] Processing @GEQ_G with operator: " << op << endl;
-                    cout << "[DEBUG] SEM_STACK size: " << SEM_STACK.size() << ", content: ";
-                    for (size_t i = 0; i < SEM_STACK.size(); ++i) {
-                        cout << SEM_STACK[i] << " ";
-                    }
-                    cout << endl;
-
-                    if (op == "FUN") {
-                        // 
-                        if (!SEM_STACK.empty()) {
-                            string funcName = SEM_STACK.back();
-                            SEM_STACK.pop_back();
-                            qtList.push_back(Quaternion("FUN", funcName, "_", "_"));
-                        }
-                    }
-                    else if (op == "=") {
-                        // ֵ
-                        if (SEM_STACK.size() >= 2) {
-                            string rvalue = SEM_STACK.back(); SEM_STACK.pop_back();
-                            string lvalue = SEM_STACK.back(); SEM_STACK.pop_back();
-                            qtList.push_back(Quaternion("=", rvalue, "_", lvalue));
-                        }
-                    }
-                    else if (op == "+=" || op == "-=" || op == "*=" || op == "/=") {
-                        // ϸֵ
-                        if (SEM_STACK.size() >= 2) {
-                            string rvalue = SEM_STACK.back(); SEM_STACK.pop_back();
-                            string lvalue = SEM_STACK.back(); SEM_STACK.pop_back();
-
-                            // ȼ
-                            string binOp = op.substr(0, 1);
-                            stringstream ss;
-                            ss << "@t" << t_id++;
-                            string temp = ss.str();
-                            qtList.push_back(Quaternion(binOp, lvalue, rvalue, temp));
-
-                            // ٸֵ
-                            qtList.push_back(Quaternion("=", temp, "_", lvalue));
-                        }
-                    }
-                    else if (op == "++" || op == "--") {
-                        // ǰ׺Լ
-                        if (!SEM_STACK.empty()) {
-                            string var = SEM_STACK.back(); SEM_STACK.pop_back();
-
-                            stringstream ss;
-                            ss << "@t" << t_id++;
-                            string temp = ss.str();
-
-                            string binOp = (op == "++") ? "+" : "-";
-                            qtList.push_back(Quaternion(binOp, var, "1", temp));
-                            qtList.push_back(Quaternion("=", temp, "_", var));
-                        }
-                    }
-                    else if (op == "p++" || op == "p--") {
-                        // ׺Լ
-                        if (!SEM_STACK.empty()) {
-                            string var = SEM_STACK.back(); SEM_STACK.pop_back();
+    //  @PUSH_ID - ƥID token
+    void actPushId(const GrammarSymbol&, GenState& st) const {
+        st.SEM_STACK.push_back(st.lastId);
+        dbgOut() << "[DEBUG] Pushed ID to SEM_STACK: " << st.lastId << endl;
+    }
 
-                            stringstream ss;
-                            ss << "@t" << t_id++;
-                            string temp = ss.str();
+    //  @PUSH_NUM - ƥNUM token
+    void actPushNum(const GrammarSymbol&, GenState& st) const {
+        st.SEM_STACK.push_back(st.lastNum);
+        dbgOut() << "[DEBUG] Pushed NUM to SEM_STACK: " << st.lastNum << endl;
+    }
 
-                            // ȱԭֵ
-                            qtList.push_back(Quaternion("=", var, "_", temp));
+    //  @SAVE_XķʱΪö
+    void actSave(const GrammarSymbol& sym, GenState& st) const {
+        st.SYMBOL_STACK.push_back(sym.op);
+        dbgOut() << "[DEBUG] Pushed to SYMBOL_STACK: " << sym.text << endl;
+    }
 
-                            // /Լ
-                            string binOp = (op == "p++") ? "+" : "-";
-                            stringstream ss2;
-                            ss2 << "@t" << t_id++;
-                            string temp2 = ss2.str();
+    //  @GEQ_GͨԪʽ
+    void actGeqG(const GrammarSymbol&, GenState& st) const {
+        if (st.SYMBOL_STACK.empty()) {
+            return;
+        }
 
-                            qtList.push_back(Quaternion(binOp, var, "1", temp2));
-                            qtList.push_back(Quaternion("=", temp2, "_", var));
+        SemOp op = st.SYMBOL_STACK.back();
+        st.SYMBOL_STACK.pop_back();
+        vector<string>& SEM_STACK = st.SEM_STACK;
+        vector<Quaternion>& qtList = st.qtList;
 
-                            // ԭֵ
-                            SEM_STACK.push_back(temp);
-                        }
-                    }
-                    else if (op == "+" || op == "-" || op == "*" || op == "/" ||
-                        op == ">" || op == "<" || op == ">=" || op == "<=" ||
-                        op == "==" || op == "!=") {
-                        // Ԫ
-                        if (SEM_STACK.size() >= 2) {
-                            string arg2 = SEM_STACK.back(); SEM_STACK.pop_back();
-                            string arg1 = SEM_STACK.back(); SEM_STACK.pop_back();
-
-                            stringstream ss;
-                            ss << "@t" << t_id++;
-                            string temp = ss.str();
-
-                            SEM_STACK.push_back(temp);
-                            qtList.push_back(Quaternion(op, arg1, arg2, temp));
-                        }
-                    }
-                    else if (op == "return") {
-                        // return
-                        if (!SEM_STACK.empty()) {
-                            string retVal = SEM_STACK.back(); SEM_STACK.pop_back();
-                            qtList.push_back(Quaternion("return", retVal, "_", "_"));
-                        }
-                    }
-                    else if (op == "if" || op == "elif") {
-                        // 
-                        if (!SEM_STACK.empty()) {
-                            string condition = SEM_STACK.back(); SEM_STACK.pop_back();
-                            qtList.push_back(Quaternion(op, condition, "_", "_"));
-                        }
-                    }
-                    else if (op == "do") {
-                        // whileѭ
-                        if (!SEM_STACK.empty()) {
-                            string condition = SEM_STACK.back(); SEM_STACK.pop_back();
-                            qtList.push_back(Quaternion("do", condition, "_", "_"));
-                        }
-                    }
-                    else if (op == "push") {
-                        // 
-                        if (!SEM_STACK.empty()) {
-                            string arg = SEM_STACK.back(); SEM_STACK.pop_back();
-                            qtList.push_back(Quaternion("push", arg, "_", "_"));
-                        }
-                    }
-                }
-            }
-            else if (action == "break") {
-                qtList.push_back(Quaternion("break", "_", "_", "_"));
-            }
-            else if (action == "continue") {
-                qtList.push_back(Quaternion("continue", "_", "_", "_"));
-            }
-            else if (action == "el") {
-                qtList.push_back(Quaternion("el", "_", "_", "_"));
-            }
-            else if (action == "ie") {
-                qtList.push_back(Quaternion("ie", "_", "_", "_"));
-            }
-            else if (action == "wh") {
-                qtList.push_back(Quaternion("wh", "_", "_", "_"));
-            }
-            else if (action == "we") {
-                qtList.push_back(Quaternion("we", "_", "_", "_"));
-            }
-            else if (action == "c1") {
-                // зֵĺ
-                if (SEM_STACK.size() >= 2) {
-                    string funcName = SEM_STACK.back(); SEM_STACK.pop_back();
-                    string retVar = SEM_STACK.back(); SEM_STACK.pop_back();
-                    qtList.push_back(Quaternion("callr", funcName, "_", retVar));
-                }
-            }
-            else if (action == "c2") {
-                // ޷ֵĺ
-                if (!SEM_STACK.empty()) {
-                    string funcName = SEM_STACK.back(); SEM_STACK.pop_back();
-                    qtList.push_back(Quaternion("call", funcName, "_", "_"));
-                }
-            }
+        dbgOut() << "[DEBUG] Processing @GEQ_G with operator: " << SEM_OP_NAMES[op] << endl;
+        dbgOut() << "[DEBUG] SEM_STACK size: " << SEM_STACK.size() << ", content: ";
+        for (size_t i = 0; i < SEM_STACK.size(); ++i) {
+            dbgOut() << SEM_STACK[i] << " ";
+        }
+        dbgOut() << endl;
+
+        switch (op) {
+        case SOP_FUN:
+            // 
+            if (!SEM_STACK.empty()) {
+                string funcName = SEM_STACK.back();
+                SEM_STACK.pop_back();
+                qtList.push_back(Quaternion("FUN", funcName, "_", "_"));
+            }
+            break;
+
+        case SOP_ASSIGN:
+            // ֵ
+            if (SEM_STACK.size() >= 2) {
+                string rvalue = SEM_STACK.back(); SEM_STACK.pop_back();
+                string lvalue = SEM_STACK.back(); SEM_STACK.pop_back();
+                qtList.push_back(Quaternion("=", rvalue, "_", lvalue));
+            }
+            break;
+
+        case SOP_ADD_ASSIGN:
+        case SOP_SUB_ASSIGN:
+        case SOP_MUL_ASSIGN:
+        case SOP_DIV_ASSIGN:
+            // ϸֵȼٸֵ
+            if (SEM_STACK.size() >= 2) {
+                string rvalue = SEM_STACK.back(); SEM_STACK.pop_back();
+                string lvalue = SEM_STACK.back(); SEM_STACK.pop_back();
+
+                static const SemOp binOps[] = { SOP_ADD, SOP_SUB, SOP_MUL, SOP_DIV };
+                string temp = newTemp(st);
+                qtList.push_back(Quaternion(SEM_OP_NAMES[binOps[op - SOP_ADD_ASSIGN]], lvalue, rvalue, temp));
+                qtList.push_back(Quaternion("=", temp, "_", lvalue));
+            }
+            break;
+
+        case SOP_PRE_INC:
+        case SOP_PRE_DEC:
+            // ǰ׺Լ
+            if (!SEM_STACK.empty()) {
+                string var = SEM_STACK.back(); SEM_STACK.pop_back();
+                string temp = newTemp(st);
+                qtList.push_back(Quaternion(op == SOP_PRE_INC ? "+" : "-", var, "1", temp));
+                qtList.push_back(Quaternion("=", temp, "_", var));
+            }
+            break;
+
+        case SOP_POST_INC:
+        case SOP_POST_DEC:
+            // ׺Լ
+            if (!SEM_STACK.empty()) {
+                string var = SEM_STACK.back(); SEM_STACK.pop_back();
+
+                // ȱԭֵ
+                string temp = newTemp(st);
+                qtList.push_back(Quaternion("=", var, "_", temp));
+
+                // /Լ
+                string temp2 = newTemp(st);
+                qtList.push_back(Quaternion(op == SOP_POST_INC ? "+" : "-", var, "1", temp2));
+                qtList.push_back(Quaternion("=", temp2, "_", var));
+
+                // ԭֵ
+                SEM_STACK.push_back(temp);
+            }
+            break;
+
+        case SOP_ADD: case SOP_SUB: case SOP_MUL: case SOP_DIV:
+        case SOP_GT: case SOP_LT: case SOP_GE: case SOP_LE: case SOP_EQ: case SOP_NE:
+            // Ԫ
+            if (SEM_STACK.size() >= 2) {
+                string arg2 = SEM_STACK.back(); SEM_STACK.pop_back();
+                string arg1 = SEM_STACK.back(); SEM_STACK.pop_back();
+                string temp = newTemp(st);
+                SEM_STACK.push_back(temp);
+                qtList.push_back(Quaternion(SEM_OP_NAMES[op], arg1, arg2, temp));
+            }
+            break;
+
+        case SOP_RETURN:
+        case SOP_IF:
+        case SOP_ELIF:
+        case SOP_DO:
+        case SOP_PUSH:
+            // return䡢ѭԪʽ
+            if (!SEM_STACK.empty()) {
+                string value = SEM_STACK.back(); SEM_STACK.pop_back();
+                qtList.push_back(Quaternion(SEM_OP_NAMES[op], value, "_", "_"));
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    //  @GEQ_break/continue/el/ie/wh/we
+    void actGeqMarker(const GrammarSymbol& sym, GenState& st) const {
+        st.qtList.push_back(Quaternion(sym.text, "_", "_", "_"));
+    }
+
+    // зֵĺ
+    void actGeqC1(const GrammarSymbol&, GenState& st) const {
+        if (st.SEM_STACK.size() >= 2) {
+            string funcName = st.SEM_STACK.back(); st.SEM_STACK.pop_back();
+            string retVar = st.SEM_STACK.back(); st.SEM_STACK.pop_back();
+            st.qtList.push_back(Quaternion("callr", funcName, "_", retVar));
+        }
+    }
+
+    // ޷ֵĺ
+    void actGeqC2(const GrammarSymbol&, GenState& st) const {
+        if (!st.SEM_STACK.empty()) {
+            string funcName = st.SEM_STACK.back(); st.SEM_STACK.pop_back();
+            st.qtList.push_back(Quaternion("call", funcName, "_", "_"));
         }
     }
 
@@ -2601,340 +7418,1496 @@ private:
                 }
             }
 
-            P_LIST.push_back(make_pair(vn, tmp));
+            P_LIST.push_back(make_pair(vn, tmp));
+        }
+
+        cout << "[DEBUG] Loaded " << P_LIST.size() << " embedded translation productions" << endl;
+    }
+};
+
+// ============================================================================
+// Optimization class (Ż)
+// ============================================================================
+class Optimization {
+private:
+    SYMBOL* symTable;                    // űָ
+
+public:
+    // ͸Żİ汾IRɢСĶκһĽʱһ
+    // ˮɵĻ֮ʧЧ
+    static const int PIPELINE_VERSION = 2;
+
+    Optimization(SYMBOL* sym) : symTable(sym) {
+        cout << "[DEBUG] Optimization constructor called" << endl;
+    }
+
+    // IRӿڣ͵Żָ¼黮֡ӱʽ
+    // SSAϵȫֵ鹹DAG
+    void opt(IRFunction* func) {
+        dbgOut() << "[DEBUG] Optimization::opt - Starting optimization for function block" << endl;
+
+        // ȫŻSSAϽУ˳SSA
+        SSAForm ssa(*func, ssaVariables(*func));
+        propagateConstants(ssa);
+        numberValues(ssa);
+        if (!ssa.lower(*func)) {
+            dbgOut() << "[DEBUG] SSA: function " << func->name << " kept in original form" << endl;
+        }
+
+        pruneBranches(*func);
+        coalesceCopies(*func);
+        propagateCopies(*func);
+        hoistInvariants(*func);
+        reduceStrength(*func);
+        propagateCopies(*func);
+        coalesceCopies(*func);
+        eliminateDeadCode(*func);
+
+        // жںΪȽת˺ָ±Ǳţɾָ
+        fuseBranches(*func);
+    }
+
+    // Ƚתںϡ if/elif/do ͬıȽϺϲΪһ
+    // (if<, a, b, LĿ)ʱĿָֻһȽϺһ
+    // תذѱȽϽʱֻһεıȽʱʱ
+    //  != 0ںϡ
+    void fuseBranches(IRFunction& func) {
+        IRCode& code = func.code;
+        int n = static_cast<int>(code.size());
+        vector<int> jump = IRInterpreter::jumpTargets(code);
+        vector<bool> isTarget(n + 1, false);
+        for (int i = 0; i < n; ++i) {
+            if (jump[i] >= 0) isTarget[jump[i]] = true;
+        }
+        map<uint32_t, int> tempUses;
+        for (int i = 0; i < n; ++i) {
+            countTempUse(code[i].a, func, tempUses);
+            countTempUse(code[i].b, func, tempUses);
+            if (code[i].r.kind() == IRO_REF) countTempUse(code[i].r, func, tempUses);
+        }
+
+        vector<bool> removed(n, false);
+        int fused = 0;
+        for (int i = 0; i < n; ++i) {
+            IROpcode op = code[i].opcode();
+            if ((op != IR_IF && op != IR_ELIF && op != IR_DO) || jump[i] < 0) continue;
+
+            IRInst br(IR_BR, code[i].a, IROperand::imm(0), IROperand());
+            br.flags = static_cast<uint8_t>(op);
+            br.aux = static_cast<uint16_t>(IR_NE);
+            const IRInst* prev = i > 0 ? &code[i - 1] : NULL;
+            if (prev && prev->opcode() >= IR_GT && prev->opcode() <= IR_NE && !isTarget[i] &&
+                prev->r.kind() == IRO_TEMP && prev->r == code[i].a && tempUses[prev->r.index()] == 1) {
+                br.a = prev->a;
+                br.b = prev->b;
+                br.aux = static_cast<uint16_t>(prev->opcode());
+                removed[i - 1] = true;
+                fused++;
+            }
+            code[i] = br;
+        }
+
+        // ɾϲıȽϺ±ţɾıȽӳ䵽ڵıȽת
+        vector<int> newIndex(n + 1, 0);
+        int count = 0;
+        for (int i = 0; i < n; ++i) {
+            newIndex[i] = count;
+            if (!removed[i]) count++;
+        }
+        newIndex[n] = count;
+        int w = 0;
+        for (int i = 0; i < n; ++i) {
+            if (removed[i]) continue;
+            if (code[i].opcode() == IR_BR) {
+                code[i].r = IROperand::make(IRO_LABEL, static_cast<uint32_t>(newIndex[jump[i]]));
+            }
+            code[w++] = code[i];
+        }
+        code.resize(w);
+
+        func.blockStarts.clear();
+        ControlFlowGraph cfg(func);
+        for (size_t b = 0; b < cfg.blocks.size(); ++b) {
+            if (cfg.blocks[b].first < cfg.blocks[b].last) {
+                func.blockStarts.push_back(static_cast<uint32_t>(cfg.blocks[b].first));
+            }
+        }
+
+        dbgOut() << "[DEBUG] Branch fusion: " << fused << " compare(s) merged into branches in "
+            << func.name << endl;
+    }
+
+    // ϡSCCPSSA϶ÿֵֵδ /  / ǳ
+    // ͬʱֻؿִеıߴǳ if/elif/do ֻһִ̿У
+    // ִеǰphiĺϲԷ֧߶ͬѭ
+    // һֱֳֵıҲܵõڵֵýͽṹ
+    // ԪءSSAıǳִпжֵĲΪ
+    // ǳͱȽ۵Ϊֵ㰴64λ
+    // ƣһ£0۵ʱ
+    // Ϊķ֧ pruneBranches ˳SSAɾ
+    void propagateConstants(SSAForm& ssa) {
+        const ControlFlowGraph& cfg = ssa.cfg;
+        size_t nb = ssa.code.size();
+        vector<ConstLattice> lattice(ssa.values.size());
+        for (size_t v = 0; v < ssa.values.size(); ++v) {
+            if (ssa.values[v].block < 0) lattice[v].state = ConstLattice::VARYING;
+        }
+        vector<bool> executable(nb, false);
+        set<pair<int, int> > edges;         // ִеı
+        executable[cfg.entry()] = true;
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t r = 0; r < cfg.rpo.size(); ++r) {
+                int b = cfg.rpo[r];
+                if (!executable[b]) continue;
+
+                const vector<int>& preds = cfg.blocks[b].preds;
+                for (size_t i = 0; i < ssa.phis[b].size(); ++i) {
+                    const SSAForm::Phi& phi = ssa.phis[b][i];
+                    ConstLattice x;
+                    for (size_t j = 0; j < preds.size(); ++j) {
+                        if (phi.args[j] >= 0 && edges.count(make_pair(preds[j], b))) x.meet(lattice[phi.args[j]]);
+                    }
+                    changed |= lattice[phi.value].update(x);
+                }
+
+                for (size_t i = 0; i < ssa.code[b].size(); ++i) {
+                    const SSAForm::Inst& x = ssa.code[b][i];
+                    if (x.val[2] >= 0) changed |= lattice[x.val[2]].update(evaluate(x, lattice));
+                }
+
+                // Ϊʱֻһִ̿Уsuccs[0] Ϊķ֧
+                const vector<int>& succs = cfg.blocks[b].succs;
+                const SSAForm::Inst* last = ssa.code[b].empty() ? NULL : &ssa.code[b].back();
+                IROpcode marker = last ? last->inst.marker() : IR_NOP;
+                for (size_t k = 0; k < succs.size(); ++k) {
+                    if ((marker == IR_IF || marker == IR_ELIF || marker == IR_DO) && succs.size() == 2) {
+                        ConstLattice cond = operandValue(*last, 0, lattice);
+                        if (cond.state == ConstLattice::UNKNOWN) continue;
+                        if (cond.state == ConstLattice::CONSTANT && (cond.value != 0) != (k == 0)) continue;
+                    }
+                    if (edges.insert(make_pair(b, succs[k])).second) changed = true;
+                    if (!executable[succs[k]]) {
+                        executable[succs[k]] = true;
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        int replaced = 0, folded = 0;
+        for (size_t b = 0; b < nb; ++b) {
+            if (!executable[b]) continue;
+            for (size_t i = 0; i < ssa.code[b].size(); ++i) {
+                SSAForm::Inst& x = ssa.code[b][i];
+                IROpcode op = x.inst.opcode();
+                IROperand* ops[2] = { &x.inst.a, &x.inst.b };
+                for (int k = 0; k < 2; ++k) {
+                    if (!SSAForm::usesOperand(op, k) || x.val[k] < 0) continue;
+                    const ConstLattice& c = lattice[x.val[k]];
+                    if (c.state != ConstLattice::CONSTANT || !IROperand::fitsImm(static_cast<long>(c.value))) continue;
+                    *ops[k] = IROperand::imm(static_cast<int>(c.value));
+                    x.val[k] = -1;
+                    replaced++;
+                }
+                ConstLattice result = evaluate(x, lattice);
+                if (op >= IR_ADD && op <= IR_NE && result.state == ConstLattice::CONSTANT &&
+                    IROperand::fitsImm(static_cast<long>(result.value))) {
+                    x.inst = IRInst(IR_ASSIGN, IROperand::imm(static_cast<int>(result.value)), IROperand(), x.inst.r);
+                    x.val[0] = x.val[1] = -1;
+                    folded++;
+                }
+            }
+        }
+
+        dbgOut() << "[DEBUG] SCCP: " << replaced << " operand(s) replaced by constants, " << folded
+            << " operation(s) folded" << endl;
+    }
+
+    // ȫֵţGVNSSA֧ÿSSAֵһֵţ
+    // 㰴룬ֵŻɼͬͬ
+    // +  * Ⱥ󡣼֧䱾ʱ
+    // ΪǸֵֵ if/elif ĸ֧ͺظ
+    //  if ֮ǰǰеĽֵԴֵŴphi Ĳ
+    // Ŷͬʱ phi ҲȡšSSAıܱд
+    // ǵ㲻šõֵڵı˴Ա汾
+    // ˳SSAʱ޷ԭʱɱĽ
+    // ѭвѭⶨֵ㲻Ϊѭֵѭᡣ
+    void numberValues(SSAForm& ssa) {
+        vector<int> number(ssa.values.size());
+        for (size_t v = 0; v < number.size(); ++v) {
+            number[v] = static_cast<int>(v);
+        }
+        vector<vector<int> > in, out;
+        ssa.computeStorage(in, out);
+        map<ValueKey, int> table;
+        int replaced = 0;
+        numberBlock(ssa, ssa.cfg.entry(), ssa.cfg.dominatorChildren(), in, number, table, replaced);
+        dbgOut() << "[DEBUG] GVN: " << replaced << " redundant operation(s) replaced by copies" << endl;
+    }
+
+    // ɾΪķ֧ṹIR if Ϊ
+    //   if c1 A el [c2 elif c2 B el ...] [C] ie
+    //  if/elif Լķ֧ɾȥĸֻ֧ ie
+    // ٵ if/elif ͬԼķ֧ el һɾȥɾ if
+    //  elif Ϊ ifû elif ʱʣµ else ֧ȥ ie ֱִС
+    // ٵ while ɾȥ wh  dowe do ѭ break ˳
+    // Ĵԭɺɾ
+    void pruneBranches(IRFunction& func) {
+        int pruned = 0;
+        while (pruneOne(func.code)) pruned++;
+        if (pruned > 0) {
+            func.blockStarts.clear();
+            dbgOut() << "[DEBUG] Pruned " << pruned << " constant branch(es) in " << func.name << endl;
+        }
+    }
+
+    // ƺϲϸֵ׺ѭȻ
+    // (op, x, y, s) (=, s, _, d)  s ٸƵĴ롣s ڸ֮
+    // ٻԾʱĽֱӸΪ d ɾȥơָͬһУ
+    // м䲻д s  dd  main бɼıʱмҲеá
+    // d ҲԪػṹԱs Ϊʱ㲻ǵãʱм
+    // ܷͬһṹ塢ܸд±꣬Ҳеá
+    void coalesceCopies(IRFunction& func) {
+        IRCode& code = func.code;
+        int n = static_cast<int>(code.size());
+        set<string> tracked, globals;
+        copyVariables(func, tracked, globals);
+        ControlFlowGraph cfg(func);
+        Liveness live(func, cfg, globals, globals);
+
+        vector<bool> removed(n, false);
+        int coalesced = 0;
+        for (size_t b = 0; b < cfg.blocks.size(); ++b) {
+            const CFGBlock& blk = cfg.blocks[b];
+            if (!cfg.reachable(static_cast<int>(b))) continue;
+            set<string> after = live.liveOut[b];
+            for (int i = blk.last - 1; i >= blk.first; --i) {
+                const IRInst copy = code[i];
+                bool element = copy.r.kind() == IRO_REF && copy.a.kind() == IRO_TEMP;
+                bool candidate = copy.opcode() == IR_ASSIGN && copy.a != copy.r &&
+                    copyOperand(func, copy.a, tracked, false) &&
+                    (element || copyOperand(func, copy.r, tracked, false)) &&
+                    !after.count(func.operandText(copy.a));
+                Liveness::transfer(func, copy, globals, after);
+                if (!candidate) continue;
+
+                bool visible = element || (copy.r.kind() == IRO_SYM && globals.count(func.operandText(copy.r)));
+                for (int j = i - 1; j >= blk.first; --j) {
+                    if (removed[j]) continue;
+                    IROpcode op = code[j].opcode();
+                    if (op == IR_RAW || (visible && (op == IR_CALL || op == IR_CALLR))) break;
+                    if (code[j].r == copy.a && SSAForm::definesResult(op)) {
+                        code[j].r = copy.r;
+                        removed[i] = true;
+                        coalesced++;
+                        break;
+                    }
+                    if (mentions(func, code[j], copy.a) || mentions(func, code[j], copy.r)) break;
+                    if (element && touchesElement(func, code[j], func.refs[copy.r.index()])) break;
+                }
+            }
+        }
+
+        int w = 0;
+        for (int i = 0; i < n; ++i) {
+            if (!removed[i]) code[w++] = code[i];
+        }
+        code.resize(w);
+        if (coalesced > 0) {
+            func.blockStarts.clear();
+        }
+        dbgOut() << "[DEBUG] Copy coalescing: " << coalesced << " copy(ies) merged into their definitions in "
+            << func.name << endl;
+    }
+
+    // ȫָƴ (=, s, _, d) øơǰ
+    // ·һֱãֱ d  s ¶ֵϴȡ
+    // main еĵûдɼıڸƿõĵطѶ d 
+    // ȡΪ s滻ֵɾȥ
+    // s ʱı滻ǳ
+    // 㲻滻۵ԪءṹԱ±겻滻
+    void propagateCopies(IRFunction& func) {
+        IRCode& code = func.code;
+        int n = static_cast<int>(code.size());
+        set<string> tracked, globals;
+        copyVariables(func, tracked, globals);
+
+        // ѡƼ֣룩ıֵ x ʱʹᵽ x ĸʧЧ
+        vector<int> copies, copyId(n, -1);
+        map<uint32_t, vector<int> > byName, byDest;
+        vector<int> visibleCopies;
+        for (int i = 0; i < n; ++i) {
+            const IRInst& inst = code[i];
+            if (inst.opcode() != IR_ASSIGN || inst.a == inst.r || !copyOperand(func, inst.r, tracked, false) ||
+                !copyOperand(func, inst.a, tracked, true)) {
+                continue;
+            }
+            int c = static_cast<int>(copies.size());
+            copyId[i] = c;
+            copies.push_back(i);
+            byName[inst.r.bits].push_back(c);
+            byDest[inst.r.bits].push_back(c);
+            if (inst.a.kind() == IRO_TEMP || inst.a.kind() == IRO_SYM) byName[inst.a.bits].push_back(c);
+            if ((inst.r.kind() == IRO_SYM && globals.count(func.operandText(inst.r))) ||
+                (inst.a.kind() == IRO_SYM && globals.count(func.operandText(inst.a)))) {
+                visibleCopies.push_back(c);
+            }
+        }
+        if (copies.empty()) return;
+
+        ControlFlowGraph cfg(func);
+        size_t nb = cfg.blocks.size();
+        vector<vector<bool> > out(nb, vector<bool>(copies.size(), true));
+        vector<vector<bool> > in(nb, vector<bool>(copies.size(), false));
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t r = 0; r < cfg.rpo.size(); ++r) {
+                int b = cfg.rpo[r];
+                vector<bool> cur(copies.size(), b != cfg.entry());
+                const vector<int>& preds = cfg.blocks[b].preds;
+                for (size_t j = 0; j < preds.size() && b != cfg.entry(); ++j) {
+                    if (!cfg.reachable(preds[j])) continue;
+                    for (size_t c = 0; c < copies.size(); ++c) {
+                        if (!out[preds[j]][c]) cur[c] = false;
+                    }
+                }
+                in[b] = cur;
+                for (int i = cfg.blocks[b].first; i < cfg.blocks[b].last; ++i) {
+                    copyTransfer(code[i], copyId[i], byName, visibleCopies, cur);
+                }
+                if (cur != out[b]) {
+                    out[b] = cur;
+                    changed = true;
+                }
+            }
+        }
+
+        int replaced = 0;
+        for (size_t r = 0; r < cfg.rpo.size(); ++r) {
+            int b = cfg.rpo[r];
+            vector<bool> cur = in[b];
+            for (int i = cfg.blocks[b].first; i < cfg.blocks[b].last; ++i) {
+                IRInst& inst = code[i];
+                IROpcode op = inst.opcode();
+                IROperand* ops[2] = { &inst.a, &inst.b };
+                for (int k = 0; k < 2; ++k) {
+                    if (!SSAForm::usesOperand(op, k) || (k == 0 && copyId[i] >= 0)) continue;
+                    IROperand value = *ops[k];
+                    for (int hops = 0; hops < 8; ++hops) {
+                        map<uint32_t, vector<int> >::const_iterator it = byDest.find(value.bits);
+                        if (it == byDest.end()) break;
+                        int c = -1;
+                        for (size_t m = 0; m < it->second.size(); ++m) {
+                            if (cur[it->second[m]]) c = it->second[m];
+                        }
+                        if (c < 0) break;
+                        value = code[copies[c]].a;
+                    }
+                    const IROperand& other = k == 0 ? inst.b : inst.a;
+                    bool constant = value.kind() == IRO_IMM || value.kind() == IRO_CONST;
+                    if (value == *ops[k] || (constant && op >= IR_ADD && op <= IR_NE &&
+                        (other.kind() == IRO_IMM || other.kind() == IRO_CONST))) {
+                        continue;
+                    }
+                    *ops[k] = value;
+                    replaced++;
+                }
+                copyTransfer(inst, copyId[i], byName, visibleCopies, cur);
+            }
+        }
+
+        dbgOut() << "[DEBUG] Copy propagation: " << replaced << " operand(s) replaced in " << func.name << endl;
+    }
+
+    // ɾ
+    // ɾɴĴ룺return/break/continue ֮Լ֧ߵ if 
+    // while ֮󣬵ͬһһ el/elif/ie/we ΪָֹִвṹIR
+    // ֻЩתĿٰ꣩ȫĻԾӺǰɾٱ
+    // ȡĸֵ㣬ɾĶֵ֮ظûпɾΪֹ
+    // ֻɾʱͱĶֵáǷ㳣ĳ
+    // ԪأԽ磩ʹҲmain ıɼ
+    // ʱҲҪֵڵôͺڶԾĳ⣩
+    void eliminateDeadCode(IRFunction& func) {
+        Function* funcTable = functionTable(func.name);
+        set<string> tracked, globals;
+        if (funcTable) {
+            tracked = Liveness::scalarVariables(*symTable, *funcTable);
+            if (func.name == "main") globals = Liveness::mainGlobals(tracked);
+        }
+
+        int unreachable = 0, dead = 0;
+        for (bool changed = true; changed; ) {
+            IRCode& code = func.code;
+            int n = static_cast<int>(code.size());
+            ControlFlowGraph cfg(func);
+            vector<bool> removed(n, false);
+
+            for (size_t b = 0; b < cfg.blocks.size(); ++b) {
+                const CFGBlock& blk = cfg.blocks[b];
+                if (cfg.reachable(static_cast<int>(b)) || blk.first >= blk.last || blk.first == 0) continue;
+                int end = nextMarker(code, blk.first - 1);
+                if (end < 0) end = n;
+                for (int i = blk.first; i < end; ++i) {
+                    if (!removed[i]) unreachable++;
+                    removed[i] = true;
+                }
+            }
+
+            Liveness live(func, cfg, globals, globals);
+            for (size_t b = 0; b < cfg.blocks.size(); ++b) {
+                const CFGBlock& blk = cfg.blocks[b];
+                if (!cfg.reachable(static_cast<int>(b))) continue;
+                set<string> after = live.liveOut[b];
+                for (int i = blk.last - 1; i >= blk.first; --i) {
+                    string def = Liveness::defined(func, code[i]);
+                    bool selfCopy = code[i].opcode() == IR_ASSIGN && code[i].a == code[i].r;
+                    if (!def.empty() && (def[0] == '@' || tracked.count(def)) &&
+                        (selfCopy || !after.count(def)) && removable(func, code[i])) {
+                        removed[i] = true;
+                        dead++;
+                        continue;
+                    }
+                    Liveness::transfer(func, code[i], globals, after);
+                }
+            }
+
+            int w = 0;
+            for (int i = 0; i < n; ++i) {
+                if (!removed[i]) code[w++] = code[i];
+            }
+            changed = w < n;
+            code.resize(w);
+        }
+
+        if (unreachable + dead > 0) {
+            func.blockStarts.clear();
+        }
+        dbgOut() << "[DEBUG] DCE: " << unreachable << " unreachable and " << dead
+            << " dead instruction(s) removed in " << func.name << endl;
+    }
+
+    // ѭᡣѭɽṹ whwe 綨continue  we  wh
+    // break  we ֮Խ wh ֮ǰλֻڴⲿѭʱһΣ
+    // Ϊǰÿ顣⴦ÿѭ˳ҳѭвı㣺
+    //   - ֵֻһεʱʱָƵ wh ֮ǰ
+    //   - Ƶ wh ֮ǰµʱԭΪֵ
+    // ѭһҲִСڵķִ֧ʱǰֵᱻʹã
+    // ˶ʱ󣺳ֻΪ㳣ģԪֻ
+    // ÿνѭִе֣wh  doСǰûпܳʱᣬ
+    // ṹԱĶȡѭд顢ṹ岻ǵĶ
+    // ѭеʱܸдʵκ main ıκαĶ
+    void hoistInvariants(IRFunction& func) {
+        IRCode& code = func.code;
+        vector<pair<int, int> > loops = whileLoops(code);
+        if (loops.empty()) return;
+
+        map<uint32_t, int> tempDefs;
+        for (size_t i = 0; i < code.size(); ++i) {
+            if (SSAForm::definesResult(code[i].opcode()) && code[i].r.kind() == IRO_TEMP) {
+                tempDefs[code[i].r.index()]++;
+            }
+        }
+
+        uint32_t nextTemp = func.tempCount();
+        int hoisted = 0;
+        for (size_t l = 0; l < loops.size(); ++l) {
+            int wh = loops[l].first;
+            int we = loops[l].second;
+            int moved = 0;
+            int added = hoistLoop(func, wh, we, tempDefs, nextTemp, moved);
+            hoisted += moved;
+            shiftLoops(loops, l, added);
+        }
+
+        dbgOut() << "[DEBUG] LICM: " << hoisted << " instruction(s) hoisted out of "
+            << loops.size() << " loop(s) in " << func.name << endl;
+    }
+
+    // ɱǿѭжֵ v = v  cc Ϊѭв
+    // ͱͱ v ǻɱѭе v * nn Ϊѭв
+    // ͱΪȡһά v * n ʱǰÿֵÿ v Ӽ c
+    // ֮漴Ӽ c * nѭκλã break/continue ʱ v * n
+    // ± i * n + k ȳ˷ΪӷIRûָ룬Ԫ԰ a[±] ʣ
+    // ԪشСɸɡֻͣ (v + c) * n  v * n + c * n
+    // ܲͬѭеʱܸд main ı
+    void reduceStrength(IRFunction& func) {
+        vector<pair<int, int> > loops = whileLoops(func.code);
+        if (loops.empty()) return;
+
+        set<uint32_t> ints;         // ͱֱ±꣩
+        Function* table = functionTable(func.name);
+        for (size_t i = 0; table && i < func.names.size(); ++i) {
+            VariableDict::const_iterator v = table->variableDict.find(func.names[i]);
+            if (v != table->variableDict.end() && !v->second.isArray && v->second.type == "int") {
+                ints.insert(static_cast<uint32_t>(i));
+            }
+        }
+
+        uint32_t nextTemp = func.tempCount();
+        map<uint32_t, int> tempUses, tempDefs;
+        for (size_t i = 0; i < func.code.size(); ++i) {
+            countTempUse(func.code[i].a, func, tempUses);
+            countTempUse(func.code[i].b, func, tempUses);
+            if (func.code[i].r.kind() == IRO_REF) countTempUse(func.code[i].r, func, tempUses);
+            else if (func.code[i].r.kind() == IRO_TEMP) tempDefs[func.code[i].r.index()]++;
+        }
+        int reduced = 0;
+        for (size_t l = 0; l < loops.size(); ++l) {
+            int added = reduceLoop(func, loops[l].first, loops[l].second, ints, tempUses, tempDefs, nextTemp, reduced);
+            shiftLoops(loops, l, added);
+        }
+
+        dbgOut() << "[DEBUG] Strength reduction: " << reduced << " multiplication(s) by induction variables in "
+            << func.name << endl;
+    }
+
+    // SSAûı
+    // õĺܶд main ı main еʱ
+    set<string> ssaVariables(const IRFunction& func) const {
+        set<string> res;
+        Function* funcTable = functionTable(func.name);
+        if (!funcTable) {
+            return res;
+        }
+
+        if (func.name == "main") {
+            for (size_t i = 0; i < func.code.size(); ++i) {
+                IROpcode op = func.code[i].opcode();
+                if (op == IR_CALL || op == IR_CALLR) {
+                    return res;
+                }
+            }
+        }
+
+        return Liveness::scalarVariables(*symTable, *funcTable);
+    }
+
+private:
+    struct ConstLattice {
+        enum State { UNKNOWN, CONSTANT, VARYING };
+        State state;
+        long long value;
+
+        ConstLattice() : state(UNKNOWN), value(0) {}
+        static ConstLattice of(long long v) { ConstLattice c; c.state = CONSTANT; c.value = v; return c; }
+        static ConstLattice varying() { ConstLattice c; c.state = VARYING; return c; }
+
+        void meet(const ConstLattice& o) {
+            if (o.state == UNKNOWN || state == VARYING) return;
+            if (state == UNKNOWN) *this = o;
+            else if (o.state == VARYING || o.value != value) state = VARYING;
+        }
+
+        bool update(const ConstLattice& o) {
+            if (o.state == state && o.value == value) return false;
+            *this = o;
+            return true;
+        }
+    };
+
+    static ConstLattice operandValue(const SSAForm::Inst& x, int slot, const vector<ConstLattice>& lattice) {
+        if (x.val[slot] >= 0) return lattice[x.val[slot]];
+        IROperand o = slot == 0 ? x.inst.a : x.inst.b;
+        return o.kind() == IRO_IMM ? ConstLattice::of(o.immValue()) : ConstLattice::varying();
+    }
+
+    static ConstLattice evaluate(const SSAForm::Inst& x, const vector<ConstLattice>& lattice) {
+        IROpcode op = x.inst.opcode();
+        if (op == IR_ASSIGN) return operandValue(x, 0, lattice);
+        if (op < IR_ADD || op > IR_NE) return ConstLattice::varying();
+        ConstLattice l = operandValue(x, 0, lattice), r = operandValue(x, 1, lattice);
+        if (l.state == ConstLattice::VARYING || r.state == ConstLattice::VARYING) return ConstLattice::varying();
+        if (l.state == ConstLattice::UNKNOWN || r.state == ConstLattice::UNKNOWN) return ConstLattice();
+        long long result;
+        return foldInt(op, l.value, r.value, result) ? ConstLattice::of(result) : ConstLattice::varying();
+    }
+
+    // ֵŵļΪ (1, ֵ)  (2, ı)
+    struct ValueKey {
+        int op;
+        pair<int, uint32_t> a, b;
+
+        bool operator<(const ValueKey& o) const {
+            if (op != o.op) return op < o.op;
+            if (a != o.a) return a < o.a;
+            return b < o.b;
+        }
+    };
+
+    static bool valueOperand(const SSAForm::Inst& x, int k, const vector<int>& number, pair<int, uint32_t>& key) {
+        const IROperand& o = k == 0 ? x.inst.a : x.inst.b;
+        if (x.val[k] >= 0) {
+            key = make_pair(1, static_cast<uint32_t>(number[x.val[k]]));
+            return true;
+        }
+        if (o.kind() == IRO_IMM || o.kind() == IRO_CONST) {
+            key = make_pair(2, o.bits);
+            return true;
+        }
+        return false;
+    }
+
+    // ֵļSSAıṹԱʱ false
+    static bool valueKey(const SSAForm::Inst& x, const vector<int>& number, ValueKey& key) {
+        IROpcode op = x.inst.opcode();
+        key.op = op;
+        key.b = make_pair(0, 0u);
+        if (op == IR_ASSIGN) {
+            return x.val[0] < 0 && valueOperand(x, 0, number, key.a);
+        }
+        if (op < IR_ADD || op > IR_NE || !valueOperand(x, 0, number, key.a) || !valueOperand(x, 1, number, key.b)) {
+            return false;
+        }
+        if ((op == IR_ADD || op == IR_MUL) && key.b < key.a) {
+            swap(key.a, key.b);
+        }
+        return true;
+    }
+
+    // ֵֵѭȣڵֵΪ 0
+    static int definedDepth(const SSAForm& ssa, int v) {
+        int b = ssa.values[v].block;
+        return b < 0 ? 0 : ssa.cfg.blocks[b].loopDepth;
+    }
+
+    static int operandDepth(const SSAForm& ssa, const SSAForm::Inst& x) {
+        int depth = 0;
+        for (int k = 0; k < 2; ++k) {
+            if (x.val[k] >= 0) depth = max(depth, definedDepth(ssa, x.val[k]));
+        }
+        return depth;
+    }
+
+    void numberBlock(SSAForm& ssa, int b, const vector<vector<int> >& children, const vector<vector<int> >& in,
+        vector<int>& number, map<ValueKey, int>& table, int& replaced) {
+        for (size_t i = 0; i < ssa.phis[b].size(); ++i) {
+            const SSAForm::Phi& phi = ssa.phis[b][i];
+            int n = -1;
+            bool same = true;
+            for (size_t j = 0; j < phi.args.size(); ++j) {
+                if (phi.args[j] < 0 || phi.args[j] == phi.value) continue;
+                if (n < 0) n = number[phi.args[j]];
+                else if (n != number[phi.args[j]]) same = false;
+            }
+            if (same && n >= 0) number[phi.value] = n;
+        }
+
+        vector<int> cur = in[b];        // ˴İ汾
+        vector<pair<ValueKey, int> > saved;     // 뿪ʱָı-1 ʾɾ
+        for (size_t i = 0; i < ssa.code[b].size(); ++i) {
+            SSAForm::Inst& x = ssa.code[b][i];
+            int result = x.val[2];
+            ValueKey key;
+            if (x.inst.opcode() == IR_ASSIGN && x.val[0] >= 0) {
+                if (result >= 0) number[result] = number[x.val[0]];
+            }
+            else if (valueKey(x, number, key)) {
+                map<ValueKey, int>::iterator it = table.find(key);
+                int old = it != table.end() ? it->second : -1;
+                if (old >= 0 && x.inst.opcode() != IR_ASSIGN && cur[ssa.values[old].var] == old &&
+                    definedDepth(ssa, old) <= operandDepth(ssa, x)) {
+                    x.inst = IRInst(IR_ASSIGN, ssa.vars[ssa.values[old].var], IROperand(), x.inst.r);
+                    x.val[0] = old;
+                    x.val[1] = -1;
+                    replaced++;
+                }
+                else if (result >= 0 && (old < 0 || cur[ssa.values[old].var] != old)) {
+                    saved.push_back(make_pair(key, old));
+                    table[key] = result;
+                }
+                if (result >= 0 && old >= 0) number[result] = number[old];
+            }
+            if (result >= 0) cur[ssa.values[result].var] = result;
+        }
+
+        for (size_t i = 0; i < children[b].size(); ++i) {
+            numberBlock(ssa, children[b][i], children, in, number, table, replaced);
         }
 
-        cout << "[DEBUG] Loaded " << P_LIST.size() << " embedded translation productions" << endl;
+        for (size_t i = saved.size(); i-- > 0;) {
+            if (saved[i].second < 0) table.erase(saved[i].first);
+            else table[saved[i].first] = saved[i].second;
+        }
     }
-};
 
-// ============================================================================
-// DAGNode struct (DAGڵṹ)
-// ============================================================================
-struct DAGNode {
-    string op;                    // 
-    int ID;                      // ڵID
-    vector<string> signs;        // бб
-    int leftNodeID;             // ӽڵID-1ʾޣ
-    int rightNodeID;            // ӽڵID-1ʾޣ
-
-    DAGNode(const string& o, int id, int left = -1, int right = -1)
-        : op(o), ID(id), leftNodeID(left), rightNodeID(right) {}
-};
+    static bool foldInt(IROpcode op, long long a, long long b, long long& result) {
+        unsigned long long ua = static_cast<unsigned long long>(a), ub = static_cast<unsigned long long>(b);
+        switch (op) {
+        case IR_ADD: result = static_cast<long long>(ua + ub); return true;
+        case IR_SUB: result = static_cast<long long>(ua - ub); return true;
+        case IR_MUL: result = static_cast<long long>(ua * ub); return true;
+        case IR_DIV:
+            if (b == 0 || (a == INT64_MIN && b == -1)) return false;
+            result = a / b;
+            return true;
+        case IR_GT: result = a > b; return true;
+        case IR_LT: result = a < b; return true;
+        case IR_GE: result = a >= b; return true;
+        case IR_LE: result = a <= b; return true;
+        case IR_EQ: result = a == b; return true;
+        case IR_NE: result = a != b; return true;
+        default: return false;
+        }
+    }
 
-// ============================================================================
-// Optimization class (DAGŻ)
-// ============================================================================
-class Optimization {
-private:
-    SYMBOL* symTable;                    // űָ
-    vector<DAGNode> nodes;               // DAGڵб
-    vector<Quaternion> new_qt;           // ŻԪʽ
-    set<string> operation;               // 
+    //  from ֮ͬһһ el/elif/ie weǶ׵ if  while
+    static int nextMarker(const IRCode& code, int from) {
+        int depth = 0;
+        for (int i = from + 1; i < static_cast<int>(code.size()); ++i) {
+            IROpcode op = code[i].marker();
+            if (op == IR_IF || op == IR_WH) {
+                depth++;
+            }
+            else if (op == IR_IE || op == IR_WE) {
+                if (depth == 0) return i;
+                depth--;
+            }
+            else if ((op == IR_EL || op == IR_ELIF) && depth == 0) {
+                return i;
+            }
+        }
+        return -1;
+    }
 
-public:
-    Optimization(SYMBOL* sym) : symTable(sym) {
-        cout << "[DEBUG] Optimization constructor called" << endl;
+    //  if еĳλҵ ie
+    static int chainEnd(const IRCode& code, int from) {
+        int i = nextMarker(code, from);
+        while (i >= 0 && code[i].marker() != IR_IE) i = nextMarker(code, i);
+        return i;
+    }
+
+    // ɾһΪķ֧ûпɾķ false
+    static bool pruneOne(IRCode& code) {
+        int n = static_cast<int>(code.size());
+        vector<bool> removed(n, false);
+        bool done = false;
+        for (int p = 0; p < n && !done; ++p) {
+            IROpcode op = code[p].opcode();
+            if ((op != IR_IF && op != IR_ELIF && op != IR_DO) || code[p].a.kind() != IRO_IMM) continue;
+            bool taken = code[p].a.immValue() != 0;
+
+            if (op == IR_DO) {
+                int we = nextMarker(code, p);
+                int wh = p;
+                while (wh >= 0 && code[wh].marker() != IR_WH) wh--;
+                if (taken || we < 0 || wh < 0 || code[we].marker() != IR_WE) continue;
+                removed[wh] = true;
+                for (int i = p; i <= we; ++i) removed[i] = true;
+                done = true;
+                continue;
+            }
 
-        // ʼ
-        operation.insert("+");
-        operation.insert("-");
-        operation.insert("*");
-        operation.insert("/");
-        operation.insert("=");
-        operation.insert(">");
-        operation.insert("<");
-        operation.insert("==");
-        operation.insert(">=");
-        operation.insert("<=");
-        operation.insert("!=");
-    }
-
-    // Ż
-    vector<vector<Quaternion> > opt(const vector<Quaternion>& funcBlock) {
-        cout << "[DEBUG] Optimization::opt - Starting optimization for function block" << endl;
-
-        vector<Quaternion> fBlock = funcBlock;  // ƺ
-        vector<vector<Quaternion> > res;        // б
-        vector<Quaternion> bloc;                // ǰ
-
-        // 黮Ϊ
-        while (!fBlock.empty()) {
-            Quaternion tmp = fBlock[0];
-            fBlock.erase(fBlock.begin());
-
-            if (tmp.op == "wh") {
-                if (!bloc.empty()) {
-                    res.push_back(bloc);
-                }
-                bloc.clear();
-                bloc.push_back(tmp);
-            }
-            else if (tmp.op == "do" || tmp.op == "we" || tmp.op == "if" ||
-                tmp.op == "el" || tmp.op == "elif" || tmp.op == "ie" ||
-                tmp.op == "return" || tmp.op == "continue" || tmp.op == "break") {
-                bloc.push_back(tmp);
-                res.push_back(bloc);
-                bloc.clear();
-            }
-            else if (tmp.op == "FUN") {
-                vector<Quaternion> funBloc;
-                funBloc.push_back(tmp);
-                res.push_back(funBloc);
+            int m = nextMarker(code, p);        // ֧֮ el  ie
+            int q = chainEnd(code, p);
+            if (m < 0 || q < 0 || code[m].marker() == IR_ELIF) continue;
+            removed[p] = true;
+            if (taken) {
+                // ķִ֧
+                if (code[m].marker() == IR_EL) {
+                    for (int i = m; i < q; ++i) removed[i] = true;
+                    if (op == IR_IF) removed[q] = true;
+                }
+                else if (op == IR_IF) {
+                    removed[q] = true;
+                }
             }
             else {
-                bloc.push_back(tmp);
+                // ִ֧
+                for (int i = p; i < m; ++i) removed[i] = true;
+                if (code[m].marker() == IR_EL) {
+                    removed[m] = true;
+                    int next = nextMarker(code, m);
+                    if (op == IR_IF) {
+                        if (next >= 0 && code[next].marker() == IR_ELIF) code[next].op = static_cast<uint8_t>(IR_IF);
+                        else removed[q] = true;
+                    }
+                }
+                else if (op == IR_IF) {
+                    removed[q] = true;
+                }
             }
+            done = true;
         }
+        if (!done) return false;
 
-        // һ
-        if (!bloc.empty()) {
-            res.push_back(bloc);
+        int w = 0;
+        for (int i = 0; i < n; ++i) {
+            if (!removed[i]) code[w++] = code[i];
         }
+        code.resize(w);
+        return true;
+    }
 
-        // Żÿ
-        vector<vector<Quaternion> > funcBlock_new;
-        for (size_t i = 0; i < res.size(); ++i) {
-            optTheBloc(res[i]);
-            funcBlock_new.push_back(new_qt);
+    Function* functionTable(const string& name) const {
+        for (size_t i = 0; i < symTable->functionList.size(); ++i) {
+            if (symTable->functionList[i]->functionName == name) return symTable->functionList[i];
         }
-
-        cout << "[DEBUG] Optimization completed. " << res.size()
-            << " basic blocks processed" << endl;
-
-        return funcBlock_new;
+        return NULL;
     }
 
-private:
-    // Ż
-    void optTheBloc(const vector<Quaternion>& bloc) {
-        cout << "[DEBUG] Optimizing basic block with " << bloc.size()
-            << " quaternions" << endl;
+    // ɽṹҳ while ѭ (wh, we) we ˳Уڲѭǰ
+    static vector<pair<int, int> > whileLoops(const IRCode& code) {
+        vector<pair<int, int> > loops;
+        vector<int> open;
+        for (int i = 0; i < static_cast<int>(code.size()); ++i) {
+            IROpcode op = code[i].marker();
+            if (op == IR_WH) {
+                open.push_back(i);
+            }
+            else if (op == IR_WE && !open.empty()) {
+                loops.push_back(make_pair(open.back(), i));
+                open.pop_back();
+            }
+        }
+        return loops;
+    }
 
-        nodes.clear();
-        new_qt.clear();
+    //  l ѭ added ָ wh ֮ǰѭڣ
+    // ѭƣѭ we 
+    static void shiftLoops(vector<pair<int, int> >& loops, size_t l, int added) {
+        for (size_t k = l + 1; k < loops.size(); ++k) {
+            if (loops[k].first > loops[l].first) loops[k].first += added;
+            if (loops[k].second > loops[l].second) loops[k].second += added;
+        }
+    }
 
-        // DAG
-        for (size_t i = 0; i < bloc.size(); ++i) {
-            const Quaternion& qt = bloc[i];
+    // v = v + cv = c + v  v = v - c ʽĶֵ c  sub ָǷΪ
+    static bool inductionStep(const IRInst& inst, const set<uint32_t>& ints, const set<uint32_t>& written,
+        IROperand& step, bool& sub) {
+        IROpcode op = inst.opcode();
+        if ((op != IR_ADD && op != IR_SUB) || inst.r.kind() != IRO_SYM || !ints.count(inst.r.index())) return false;
+        sub = op == IR_SUB;
+        if (inst.a == inst.r) step = inst.b;
+        else if (op == IR_ADD && inst.b == inst.r) step = inst.a;
+        else return false;
+        return loopConstant(step, ints, written);
+    }
 
-            if (operation.find(qt.op) != operation.end()) {
-                if (qt.op == "=") {
-                    // һԪֵ
-                    int idB = Get_NODE(qt.arg1);
-                    delete_sym(qt.result);
-                    add_to_node(idB, qt.result);
-                }
-                else {
-                    // Ԫ
-                    // ǷԽг۵
-                    if (isNumber(qt.arg1) && isNumber(qt.arg2)) {
-                        // ۵
-                        double val1 = atof(qt.arg1.c_str());
-                        double val2 = atof(qt.arg2.c_str());
-                        double result = 0;
-
-                        if (qt.op == "+") result = val1 + val2;
-                        else if (qt.op == "-") result = val1 - val2;
-                        else if (qt.op == "*") result = val1 * val2;
-                        else if (qt.op == "/") result = val1 / val2;
+    // ѭвѭûбдͱ
+    static bool loopConstant(IROperand o, const set<uint32_t>& ints, const set<uint32_t>& written) {
+        return o.kind() == IRO_IMM || (o.kind() == IRO_SYM && ints.count(o.index()) && !written.count(o.index()));
+    }
 
-                        stringstream ss;
-                        ss << result;
-                        int idP = Get_NODE(ss.str());
-                        delete_sym(qt.result);
-                        add_to_node(idP, qt.result);
+    // һѭжԹɱĳ˷ָ
+    int reduceLoop(IRFunction& func, int wh, int we, const set<uint32_t>& ints, map<uint32_t, int>& tempUses,
+        map<uint32_t, int>& tempDefs, uint32_t& nextTemp, int& reduced) {
+        IRCode& code = func.code;
+        set<uint32_t> written;
+        for (int i = wh; i <= we; ++i) {
+            IROpcode op = code[i].opcode();
+            if (op == IR_CALL || op == IR_CALLR || op == IR_RAW) return 0;
+            if (!SSAForm::definesResult(op)) continue;
+            if (code[i].r.kind() == IRO_SYM) written.insert(code[i].r.index());
+            else if (code[i].r.kind() == IRO_REF) written.insert(func.refs[code[i].r.index()].base);
+        }
+
+        // ɱѭеÿֵ v = v  c
+        map<uint32_t, bool> inductive;
+        for (int i = wh; i <= we; ++i) {
+            if (!SSAForm::definesResult(code[i].opcode()) || code[i].r.kind() != IRO_SYM) continue;
+            IROperand step;
+            bool sub;
+            bool ok = inductionStep(code[i], ints, written, step, sub);
+            map<uint32_t, bool>::iterator it = inductive.find(code[i].r.index());
+            if (it == inductive.end()) inductive[code[i].r.index()] = ok;
+            else it->second = it->second && ok;
+        }
+
+        // ÿ (v, n) һʱǰÿֵ
+        // ˻ֵֻһεʱֻڱ v ı֮ǰʱ
+        // ˷ֱɾȡΪάʱ˷Ϊֵ
+        map<pair<uint32_t, uint32_t>, IROperand> products;
+        map<uint32_t, IROperand> renamed;
+        vector<IRInst> preheader;
+        vector<pair<uint32_t, uint32_t> > keys(we - wh + 1, make_pair(0u, 0u));
+        vector<bool> isProduct(we - wh + 1, false);
+        int ifDepth = 0, loopDepth = 0;
+        for (int i = wh; i <= we; ++i) {
+            // ֻÿִֶУڱ֧Уڲѭеĳ˷ֵ
+            // ÿֶҪĸ¿ܱżִеĳ˷
+            IROpcode marker = code[i].marker();
+            if (marker == IR_IF) ifDepth++;
+            else if (marker == IR_IE) ifDepth--;
+            else if (marker == IR_WH && i > wh) loopDepth++;
+            else if (marker == IR_WE && i < we) loopDepth--;
+            if (code[i].opcode() != IR_MUL || (ifDepth > 0 && loopDepth == 0)) continue;
+            IROperand v = code[i].a, n = code[i].b;
+            if (v.kind() != IRO_SYM || !inductive[v.index()]) swap(v, n);
+            if (v.kind() != IRO_SYM || !inductive[v.index()] || v == n || !loopConstant(n, ints, written)) continue;
+            pair<uint32_t, uint32_t> key(v.index(), n.bits);
+            if (!products.count(key)) {
+                products[key] = IROperand::make(IRO_TEMP, nextTemp++);
+                tempDefs[products[key].index()] = 1;
+                preheader.push_back(IRInst(IR_MUL, v, n, products[key]));
+            }
+            keys[i - wh] = key;
+            isProduct[i - wh] = true;
+
+            IROperand x = code[i].r;
+            if (x.kind() != IRO_TEMP || tempDefs[x.index()] != 1) continue;
+            map<uint32_t, int> uses;
+            for (int j = i + 1; j < we; ++j) {
+                countTempUse(code[j].a, func, uses);
+                countTempUse(code[j].b, func, uses);
+                if (code[j].r.kind() == IRO_REF) countTempUse(code[j].r, func, uses);
+                IROpcode marker = code[j].marker();
+                if ((SSAForm::definesResult(code[j].opcode()) && code[j].r == v) ||
+                    ControlFlowGraph::endsBlock(marker) || marker == IR_WH) break;
+            }
+            if (uses[x.index()] == tempUses[x.index()]) renamed[x.index()] = products[key];
+        }
+        if (products.empty()) return 0;
+
+        for (map<uint32_t, IROperand>::const_iterator it = renamed.begin(); it != renamed.end(); ++it) {
+            tempUses[it->second.index()] += tempUses[it->first];
+            tempUses[it->first] = 0;
+        }
+        for (size_t k = 0; k < func.refs.size(); ++k) {
+            func.refs[k].index = renameTemp(func.refs[k].index, renamed);
+        }
+
+        map<pair<pair<uint32_t, uint32_t>, uint32_t>, IROperand> steps;     // ((v, n), c) -> c * n
+        vector<IRInst> loop;
+        for (int i = wh; i <= we; ++i) {
+            IRInst inst = code[i];
+            inst.a = renameTemp(inst.a, renamed);
+            inst.b = renameTemp(inst.b, renamed);
+            if (isProduct[i - wh]) {
+                reduced++;
+                if (inst.r.kind() == IRO_TEMP && renamed.count(inst.r.index())) continue;
+                inst = IRInst(IR_ASSIGN, products[keys[i - wh]], IROperand(), inst.r);
+            }
+            loop.push_back(inst);
+            if (inst.r.kind() != IRO_SYM || !inductive[inst.r.index()]) continue;
+
+            // v ı֮ͬĸ˻
+            IROperand c;
+            bool sub = false;
+            inductionStep(inst, ints, written, c, sub);
+            for (map<pair<uint32_t, uint32_t>, IROperand>::const_iterator p = products.begin(); p != products.end(); ++p) {
+                if (p->first.first != inst.r.index()) continue;
+                IROperand n;
+                n.bits = p->first.second;
+                pair<pair<uint32_t, uint32_t>, uint32_t> stepKey(p->first, c.bits);
+                if (!steps.count(stepKey)) {
+                    long value = n.kind() == IRO_IMM && c.kind() == IRO_IMM ? static_cast<long>(n.immValue()) * c.immValue() : 0;
+                    if (c == IROperand::imm(1)) {
+                        steps[stepKey] = n;
+                    }
+                    else if (n.kind() == IRO_IMM && c.kind() == IRO_IMM && IROperand::fitsImm(value)) {
+                        steps[stepKey] = IROperand::imm(static_cast<int>(value));
                     }
                     else {
-                        // ĶԪ
-                        int idB = Get_NODE(qt.arg1);
-                        int idC = Get_NODE(qt.arg2);
-                        int idop = Get_NODE(qt.op, idB, idC);
-                        delete_sym(qt.result);
-                        add_to_node(idop, qt.result);
+                        steps[stepKey] = IROperand::make(IRO_TEMP, nextTemp++);
+                        preheader.push_back(IRInst(IR_MUL, c, n, steps[stepKey]));
                     }
                 }
+                loop.push_back(IRInst(sub ? IR_SUB : IR_ADD, p->second, steps[stepKey], p->second));
             }
         }
 
-        // DAGµԪʽ
-        generate_new_qt(nodes);
+        IRCode::iterator pos = code.erase(code.begin() + wh, code.begin() + we + 1);
+        pos = code.insert(pos, loop.begin(), loop.end());
+        code.insert(pos, preheader.begin(), preheader.end());
+        return static_cast<int>(preheader.size() + loop.size()) - (we - wh + 1);
+    }
 
-        // ӷԪʽ
-        int flag = 0;
-        int insertPos = 0;
+    static IROperand renameTemp(IROperand o, const map<uint32_t, IROperand>& renamed) {
+        if (o.kind() != IRO_TEMP) return o;
+        map<uint32_t, IROperand>::const_iterator it = renamed.find(o.index());
+        return it != renamed.end() ? it->second : o;
+    }
 
-        for (size_t i = 0; i < bloc.size(); ++i) {
-            const Quaternion& qt = bloc[i];
+    // һѭеĲ㣬ָmoved ΪƵǰÿ
+    int hoistLoop(IRFunction& func, int wh, int we, map<uint32_t, int>& tempDefs, uint32_t& nextTemp, int& moved) {
+        IRCode& code = func.code;
+        set<uint32_t> written;          // ѭбдıͽṹ壨ֱ±꣩
+        set<uint32_t> loopTemps;        // ѭжֵʱ
+        bool opaque = false;            // ѭеûδ֪
+        int condEnd = we;               // ֽ do
+        for (int i = wh; i <= we; ++i) {
+            const IRInst& inst = code[i];
+            IROpcode op = inst.opcode();
+            if (op == IR_CALL || op == IR_CALLR || op == IR_RAW) opaque = true;
+            if (inst.marker() == IR_DO && condEnd == we) condEnd = i;
+            if (!SSAForm::definesResult(op) && op != IR_RAW) continue;
+            if (inst.r.kind() == IRO_TEMP) loopTemps.insert(inst.r.index());
+            else if (inst.r.kind() == IRO_SYM) written.insert(inst.r.index());
+            else if (inst.r.kind() == IRO_REF) written.insert(func.refs[inst.r.index()].base);
+        }
+
+        set<uint32_t> hoistedTemps;
+        vector<IRInst> preheader;
+        vector<bool> removed(we - wh + 1, false);
+        bool mayTrap = false;           // ǰǷѭܳ
+        for (int i = wh + 1; i < we; ++i) {
+            IRInst& inst = code[i];
+            IROpcode op = inst.opcode();
+            bool binary = op >= IR_ADD && op <= IR_NE;
+            bool trapping = (op == IR_DIV && !(inst.b.kind() == IRO_IMM && inst.b.immValue() != 0)) ||
+                isArrayRef(func, inst.a) || isArrayRef(func, inst.b);
+            bool safeLoad = i < condEnd && !mayTrap;
+            bool invariant = (binary || (op == IR_ASSIGN && inst.r.kind() == IRO_TEMP)) &&
+                (op != IR_DIV || (inst.b.kind() == IRO_IMM && inst.b.immValue() != 0)) &&
+                invariantOperand(func, inst.a, written, loopTemps, hoistedTemps, opaque, safeLoad) &&
+                invariantOperand(func, inst.b, written, loopTemps, hoistedTemps, opaque, safeLoad);
+            if (!invariant) {
+                if (trapping) mayTrap = true;
+                continue;
+            }
 
-            if (operation.find(qt.op) == operation.end()) {
-                // Ԫʽ
-                if (flag == 1) {
-                    new_qt.push_back(qt);
-                }
-                else {
-                    new_qt.insert(new_qt.begin() + insertPos, qt);
-                    insertPos++;
-                }
+            if (inst.r.kind() == IRO_TEMP && tempDefs[inst.r.index()] == 1) {
+                preheader.push_back(inst);
+                hoistedTemps.insert(inst.r.index());
+                removed[i - wh] = true;
+                moved++;
             }
-            else {
-                flag = 1;
+            else if (binary) {
+                IROperand t = IROperand::make(IRO_TEMP, nextTemp++);
+                tempDefs[t.index()] = 1;
+                preheader.push_back(IRInst(op, inst.a, inst.b, t));
+                inst = IRInst(IR_ASSIGN, t, IROperand(), inst.r);
+                moved++;
             }
         }
+        if (preheader.empty()) return 0;
+
+        vector<IRInst> loop;
+        for (int i = wh; i <= we; ++i) {
+            if (!removed[i - wh]) loop.push_back(code[i]);
+        }
+        IRCode::iterator pos = code.erase(code.begin() + wh, code.begin() + we + 1);
+        pos = code.insert(pos, loop.begin(), loop.end());
+        code.insert(pos, preheader.begin(), preheader.end());
+        return static_cast<int>(preheader.size() + loop.size()) - (we - wh + 1);
     }
 
-    // ȡ򴴽DAGڵ
-    int Get_NODE(const string& sym, int leftNodeID = -1, int rightNodeID = -1) {
-        // ǲ
-        if (operation.find(sym) != operation.end()) {
-            // ѴڵĽڵ
-            for (int i = static_cast<int>(nodes.size()) - 1; i >= 0; --i) {
-                const DAGNode& node = nodes[i];
+    static bool isArrayRef(const IRFunction& func, IROperand o) {
+        return o.kind() == IRO_REF && !func.refs[o.index()].index.isNone();
+    }
 
-                if (sym == node.op) {
-                    // ڽ
-                    if (sym == "+" || sym == "*") {
-                        if ((leftNodeID == node.leftNodeID && rightNodeID == node.rightNodeID) ||
-                            (leftNodeID == node.rightNodeID && rightNodeID == node.leftNodeID)) {
-                            return node.ID;
-                        }
-                    }
-                    else {
-                        // ǽ
-                        if (leftNodeID == node.leftNodeID && rightNodeID == node.rightNodeID) {
-                            return node.ID;
-                        }
-                    }
-                }
-            }
+    // ƴͺϲ漰֣ʱͱı
+    // globals Ϊбɼģmain ı
+    void copyVariables(const IRFunction& func, set<string>& tracked, set<string>& globals) const {
+        Function* funcTable = functionTable(func.name);
+        if (!funcTable) return;
+        tracked = Liveness::scalarVariables(*symTable, *funcTable);
+        if (func.name == "main") globals = Liveness::mainGlobals(tracked);
+    }
 
-            // ½ڵ
-            DAGNode newNode(sym, static_cast<int>(nodes.size()), leftNodeID, rightNodeID);
-            nodes.push_back(newNode);
-            return newNode.ID;
+    // ܷΪƵĿ꣨ source Ϊ true ʱΪԴԴǳ
+    static bool copyOperand(const IRFunction& func, IROperand o, const set<string>& tracked, bool source) {
+        switch (o.kind()) {
+        case IRO_TEMP:
+            return true;
+        case IRO_SYM:
+            return tracked.count(func.names[o.index()]) > 0;
+        case IRO_IMM:
+        case IRO_CONST:
+            return source;
+        default:
+            return false;
         }
-        else {
-            // 
-            // Ұ÷ŵĽڵ
-            for (int i = static_cast<int>(nodes.size()) - 1; i >= 0; --i) {
-                const DAGNode& node = nodes[i];
+    }
 
-                if (find(node.signs.begin(), node.signs.end(), sym) != node.signs.end()) {
-                    return node.ID;
-                }
+    // ָǷд oΪ±꣩
+    static bool mentions(const IRFunction& func, const IRInst& inst, IROperand o) {
+        const IROperand ops[3] = { inst.a, inst.b, inst.r };
+        for (int k = 0; k < 3; ++k) {
+            if (ops[k] == o) return true;
+            if (ops[k].kind() == IRO_REF && func.refs[ops[k].index()].index == o) return true;
+        }
+        return false;
+    }
+
+    // ָǷ ref ڵṹ壬߶д±
+    static bool touchesElement(const IRFunction& func, const IRInst& inst, const IRRef& ref) {
+        const IROperand ops[3] = { inst.a, inst.b, inst.r };
+        for (int k = 0; k < 3; ++k) {
+            if (ops[k].kind() == IRO_SYM && ops[k].index() == ref.base) return true;
+            if (ops[k].kind() == IRO_REF && func.refs[ops[k].index()].base == ref.base) return true;
+        }
+        return !ref.index.isNone() && mentions(func, inst, ref.index);
+    }
+
+    // øƼϾһָֵʹᵽֵֵĸʧЧʹ漰
+    // ɼĸʧЧƱΪãδ֪ʹȫʧЧ
+    static void copyTransfer(const IRInst& inst, int copy, const map<uint32_t, vector<int> >& byName,
+        const vector<int>& visibleCopies, vector<bool>& cur) {
+        IROpcode op = inst.opcode();
+        if (op == IR_RAW) {
+            cur.assign(cur.size(), false);
+            return;
+        }
+        if (op == IR_CALL || op == IR_CALLR) {
+            for (size_t i = 0; i < visibleCopies.size(); ++i) cur[visibleCopies[i]] = false;
+        }
+        if (SSAForm::definesResult(op)) {
+            map<uint32_t, vector<int> >::const_iterator it = byName.find(inst.r.bits);
+            if (it != byName.end()) {
+                for (size_t i = 0; i < it->second.size(); ++i) cur[it->second[i]] = false;
             }
+        }
+        if (copy >= 0) cur[copy] = true;
+    }
+
+    // ʱָܷɾɾúͿܳʱ
+    static bool removable(const IRFunction& func, const IRInst& inst) {
+        IROpcode op = inst.opcode();
+        if (op == IR_CALLR || isArrayRef(func, inst.a) || isArrayRef(func, inst.b)) return false;
+        return op != IR_DIV || (inst.b.kind() == IRO_IMM && inst.b.immValue() != 0);
+    }
 
-            // ½ڵ
-            DAGNode newNode("", static_cast<int>(nodes.size()));
-            newNode.signs.push_back(sym);
-            nodes.push_back(newNode);
-            return newNode.ID;
+    // ѭǷ񲻱䣻loadable Ϊ false ʱԪصĶ
+    static bool invariantOperand(const IRFunction& func, IROperand o, const set<uint32_t>& written,
+        const set<uint32_t>& loopTemps, const set<uint32_t>& hoistedTemps, bool opaque, bool loadable) {
+        switch (o.kind()) {
+        case IRO_NONE:
+        case IRO_IMM:
+        case IRO_CONST:
+            return true;
+        case IRO_TEMP:
+            return !loopTemps.count(o.index()) || hoistedTemps.count(o.index());
+        case IRO_SYM:
+            return !opaque && !written.count(o.index());
+        case IRO_REF: {
+            const IRRef& ref = func.refs[o.index()];
+            if (opaque || written.count(ref.base)) return false;
+            if (ref.index.isNone()) return true;
+            return loadable && ref.index.kind() != IRO_REF &&
+                invariantOperand(func, ref.index, written, loopTemps, hoistedTemps, opaque, false);
+        }
+        default:
+            return false;
         }
     }
 
-    // ӽڵɾţǣ
-    bool delete_sym(const string& A) {
-        for (size_t i = 0; i < nodes.size(); ++i) {
-            DAGNode& node = nodes[i];
+    static void countTempUse(IROperand o, const IRFunction& fn, map<uint32_t, int>& uses) {
+        if (o.kind() == IRO_TEMP) uses[o.index()]++;
+        else if (o.kind() == IRO_REF) countTempUse(fn.refs[o.index()].index, fn, uses);
+    }
+};
 
-            // ҷA
-            vector<string>::iterator it = find(node.signs.begin(), node.signs.end(), A);
 
-            // ҵҲǣһԪأ
-            if (it != node.signs.end() && it != node.signs.begin()) {
-                node.signs.erase(it);
-                return true;
+// ============================================================================
+// 
+// Ԫʽ push һ call/callrҪջ֡
+// СĵÿȺ屾Inliner ڸŻ֮ǰ
+// ĵչΪĸ
+//   - ʱ±ţڵеʱ֮
+//   - ֲΪ $$ţԴıʶ $ͻ
+//     Ǽǵߵķű忪ͷûȸֵľֲ㣻
+//   - ںûбֵʱֱʵδ棬ʵθֵĲ
+//   - return Ϊ callr ĸֵ
+// ģͣ壨 FUN size ָÿõʡȥ push
+// һã size -  - 1 size  ALWAYS_SIZE 
+// Ҫ size  MAX_SIZEеõϼƵľ GROWTH_BUDGET
+// ṹIRûǰָ return 봦βֻ֮
+// el/ie ﺯĩβֻ;ֲǱҶӺͼ
+// ɺܳΪҶӣټĵߡ
+// ============================================================================
+class Inliner {
+public:
+    static const int ALWAYS_SIZE = 8;
+    static const int MAX_SIZE = 32;
+    static const int GROWTH_BUDGET = 96;
+
+    int inlinedCalls;       // չĵõ
+
+    explicit Inliner(SYMBOL* sym) : inlinedCalls(0), symTable(sym) {}
+
+    // program еĺ֮以ֻЩδŻIR
+    // otherCallSites ǲ program еĺIR棩ĵõ
+    // ߰ĵõУ뻺״̬޹
+    void run(const vector<IRFunction*>& program, const map<string, int>& otherCallSites = map<string, int>()) {
+        functions.clear();
+        decisions.clear();
+        callSites = otherCallSites;
+        for (size_t i = 0; i < program.size(); ++i) {
+            functions[program[i]->name] = program[i];
+        }
+        for (size_t i = 0; i < program.size(); ++i) {
+            const IRFunction& fn = *program[i];
+            for (size_t k = 0; k < fn.code.size(); ++k) {
+                if (isCall(fn.code[k])) callSites[fn.names[fn.code[k].a.index()]]++;
             }
         }
-        return false;
+
+        set<string> visited;
+        vector<IRFunction*> order;
+        for (size_t i = 0; i < program.size(); ++i) {
+            postorder(program[i], visited, order);
+        }
+        for (size_t i = 0; i < order.size(); ++i) {
+            inlineCalls(*order[i]);
+        }
     }
 
-    // ӵڵ
-    void add_to_node(int nodeID, const string& sym) {
-        if (nodeID < 0 || nodeID >= static_cast<int>(nodes.size())) {
-            return;
+    // IRĺܺǰıҪǵű
+    void declareVariables(const IRFunction& fn) {
+        Function* table = findTable(fn.name);
+        if (!table) return;
+        for (size_t i = 0; i < fn.names.size(); ++i) {
+            string name = fn.names[i];
+            size_t p = name.find('$');
+            size_t q = p == string::npos ? p : name.find('$', p + 1);
+            if (q == string::npos) continue;
+            Function* callee = findTable(name.substr(0, p));
+            if (!callee) continue;
+            VariableDict::const_iterator it = callee->variableDict.find(name.substr(p + 1, q - p - 1));
+            if (it != callee->variableDict.end()) declare(table, name, it->second);
         }
+    }
+
+    // ıֻĳ
+    static bool isInlinedName(const string& name) {
+        return name.find('$') != string::npos;
+    }
+
+private:
+    SYMBOL* symTable;
+    map<string, IRFunction*> functions;
+    map<string, bool> decisions;        // ǷÿֻжһΣ
+    map<string, int> callSites;
 
-        DAGNode& node = nodes[nodeID];
+    static bool isCall(const IRInst& inst) {
+        return (inst.opcode() == IR_CALL || inst.opcode() == IR_CALLR) && inst.a.kind() == IRO_SYM;
+    }
 
-        // ʱ·Ųʱ򽻻λ
-        if (!node.signs.empty() &&
-            node.signs[0].size() > 0 && node.signs[0][0] == '@' &&
-            sym.size() > 0 && sym[0] != '@') {
-            string tmp = node.signs[0];
-            node.signs[0] = sym;
-            node.signs.push_back(tmp);
+    Function* findTable(const string& name) const {
+        for (size_t i = 0; i < symTable->functionList.size(); ++i) {
+            if (symTable->functionList[i]->functionName == name) return symTable->functionList[i];
         }
-        else {
-            node.signs.push_back(sym);
+        return NULL;
+    }
+
+    void postorder(IRFunction* fn, set<string>& visited, vector<IRFunction*>& order) {
+        if (!visited.insert(fn->name).second) return;
+        for (size_t k = 0; k < fn->code.size(); ++k) {
+            if (!isCall(fn->code[k])) continue;
+            map<string, IRFunction*>::const_iterator it = functions.find(fn->names[fn->code[k].a.index()]);
+            if (it != functions.end()) postorder(it->second, visited, order);
         }
+        order.push_back(fn);
     }
 
-    // DAGµԪʽ
-    void generate_new_qt(const vector<DAGNode>& NODES) {
-        for (size_t i = 0; i < NODES.size(); ++i) {
-            const DAGNode& node = NODES[i];
+    // return ֮󰴽ṹֻ el/ie ͵ﺯĩβ
+    static bool tailReturn(const IRCode& code, const vector<int>& jump, int i) {
+        int n = static_cast<int>(code.size());
+        int k = i + 1;
+        while (k < n) {
+            if (code[k].opcode() == IR_EL && jump[k] >= 0) k = jump[k];
+            else if (code[k].opcode() == IR_IE) k++;
+            else return false;
+        }
+        return true;
+    }
 
-            // Ҷڵ㣬
-            if (node.leftNodeID == -1 && node.rightNodeID == -1 && node.signs.size() > 1) {
-                for (size_t j = 1; j < node.signs.size(); ++j) {
-                    if (node.signs[j].size() > 0 && node.signs[j][0] != '@') {
-                        // Ai = B
-                        Quaternion qt("=", node.signs[0], "_", node.signs[j]);
-                        new_qt.push_back(qt);
-                    }
+    bool inlinable(const IRFunction& g) {
+        map<string, bool>::const_iterator it = decisions.find(g.name);
+        if (it != decisions.end()) return it->second;
+
+        bool ok = false;
+        string reason;
+        Function* table = findTable(g.name);
+        int size = static_cast<int>(g.code.size()) - 1;
+        if (g.name == "main" || !table || g.code.empty() || g.code[0].opcode() != IR_FUN) {
+            reason = "not a function body";
+        }
+        else if (size > MAX_SIZE) {
+            reason = "too large";
+        }
+        else {
+            ok = true;
+            for (VariableDict::const_iterator v = table->variableDict.begin(); ok && v != table->variableDict.end(); ++v) {
+                if (v->second.isArray || !symTable->basicTypes.count(v->second.type)) {
+                    ok = false;
+                    reason = "array or struct variable " + v->first;
                 }
             }
-            // ڲڵ㣬
-            else if (node.leftNodeID != -1 && node.rightNodeID != -1 && node.signs.size() > 1) {
-                // A = B op C
-                Quaternion qt(node.op,
-                    nodes[node.leftNodeID].signs[0],
-                    nodes[node.rightNodeID].signs[0],
-                    node.signs[0]);
-                new_qt.push_back(qt);
-
-                // 
-                for (size_t j = 1; j < node.signs.size(); ++j) {
-                    if (node.signs[j].size() > 0 && node.signs[j][0] != '@') {
-                        Quaternion qt2("=", node.signs[0], "_", node.signs[j]);
-                        new_qt.push_back(qt2);
-                    }
+            vector<int> jump = IRInterpreter::jumpTargets(g.code);
+            for (int i = 1; ok && i <= size; ++i) {
+                const IRInst& inst = g.code[i];
+                IROpcode op = inst.opcode();
+                if (op == IR_CALL || op == IR_CALLR || op == IR_RAW) {
+                    ok = false;
+                    reason = "not a leaf";
+                }
+                else if (inst.a.kind() == IRO_REF || inst.b.kind() == IRO_REF || inst.r.kind() == IRO_REF) {
+                    ok = false;
+                    reason = "memory reference";
+                }
+                else if (op == IR_RETURN && !tailReturn(g.code, jump, i)) {
+                    ok = false;
+                    reason = "return not in tail position";
                 }
             }
-            // ڲڵ㣬
-            else if (node.leftNodeID != -1 && node.rightNodeID != -1) {
-                Quaternion qt(node.op,
-                    nodes[node.leftNodeID].signs[0],
-                    nodes[node.rightNodeID].signs[0],
-                    node.signs[0]);
-                new_qt.push_back(qt);
+            int growth = size - table->numOfParameters - 1;
+            if (ok && size > ALWAYS_SIZE && growth * callSites[g.name] > GROWTH_BUDGET) {
+                ok = false;
+                reason = "code growth over budget";
             }
         }
+
+        dbgOut() << "[DEBUG] Inliner: " << g.name << " (" << size << " quaternions, "
+            << callSites[g.name] << " call site(s)) " << (ok ? "inlined" : "kept: " + reason) << endl;
+        decisions[g.name] = ok;
+        return ok;
     }
 
-    // жַǷΪ
-    bool isNumber(const string& str) {
-        if (str.empty()) return false;
+    void declare(Function* table, const string& name, const Variable& like) {
+        if (table->variableDict.find(name) != table->variableDict.end()) return;
+        int size = symTable->typeTable.info(symTable->typeTable.intern(like.type)).size;
+        table->addVariable(Token("i", 0, name, 0, 0), like.type, size);
+    }
 
-        size_t i = 0;
-        if (str[0] == '-' || str[0] == '+') i = 1;
+    // ͷ˳ȱֵڴ֮ǰûб
+    static bool assignedFirst(const IRFunction& g, uint32_t name) {
+        IROperand sym = IROperand::make(IRO_SYM, name);
+        for (size_t i = 1; i < g.code.size(); ++i) {
+            const IRInst& inst = g.code[i];
+            IROpcode op = inst.opcode();
+            if (op >= IR_IF && op <= IR_RETURN) return false;
+            if ((SSAForm::usesOperand(op, 0) && inst.a == sym) || (SSAForm::usesOperand(op, 1) && inst.b == sym)) {
+                return false;
+            }
+            if (SSAForm::definesResult(op) && inst.r == sym) return true;
+        }
+        return false;
+    }
 
-        bool hasDecimal = false;
-        for (; i < str.length(); ++i) {
-            if (str[i] == '.') {
-                if (hasDecimal) return false;
-                hasDecimal = true;
+    void inlineCalls(IRFunction& f) {
+        Function* table = findTable(f.name);
+        if (!table) return;
+
+        vector<IRInst> out;
+        out.reserve(f.code.size());
+        uint32_t nextTemp = f.tempCount();
+        int instance = 0;
+        for (size_t i = 0; i < f.code.size(); ++i) {
+            const IRInst& inst = f.code[i];
+            if (isCall(inst)) {
+                map<string, IRFunction*>::const_iterator it = functions.find(f.names[inst.a.index()]);
+                if (it != functions.end() && it->second != &f && inlinable(*it->second)) {
+                    vector<string> params = IRInterpreter::parameterNames(findTable(it->first));
+                    size_t np = params.size();
+                    bool pushed = out.size() >= np;
+                    for (size_t k = out.size() - np; pushed && k < out.size(); ++k) {
+                        pushed = out[k].opcode() == IR_PUSH;
+                    }
+                    if (pushed) {
+                        vector<IROperand> args;
+                        for (size_t k = out.size() - np; k < out.size(); ++k) {
+                            args.push_back(out[k].a);
+                        }
+                        out.resize(out.size() - np);
+                        IROperand dest = inst.opcode() == IR_CALLR ? inst.r : IROperand();
+                        expand(f, table, *it->second, params, args, dest, ++instance, nextTemp, out);
+                        inlinedCalls++;
+                        continue;
+                    }
+                }
             }
-            else if (!isdigit(str[i])) {
-                return false;
+            out.push_back(inst);
+        }
+
+        if (instance > 0) {
+            f.clearCode();
+            f.code.assign(out.begin(), out.end());
+        }
+    }
+
+    void expand(IRFunction& f, Function* table, const IRFunction& g, const vector<string>& params,
+        const vector<IROperand>& args, IROperand dest, int instance, uint32_t& nextTemp, vector<IRInst>& out) {
+        Function* calleeTable = findTable(g.name);
+        map<string, uint32_t> nameIds;
+        for (size_t j = 0; j < g.names.size(); ++j) {
+            nameIds[g.names[j]] = static_cast<uint32_t>(j);
+        }
+        set<uint32_t> assigned;
+        for (size_t i = 1; i < g.code.size(); ++i) {
+            if (SSAForm::definesResult(g.code[i].opcode()) && g.code[i].r.kind() == IRO_SYM) {
+                assigned.insert(g.code[i].r.index());
             }
         }
 
-        return true;
+        stringstream suffix;
+        suffix << "$" << instance;
+        map<uint32_t, IROperand> rename;
+
+        // ûбֵʱֱʵΣȰʵθĲ
+        for (size_t k = 0; k < params.size(); ++k) {
+            map<string, uint32_t>::const_iterator id = nameIds.find(params[k]);
+            if (id == nameIds.end()) continue;
+            if (!assigned.count(id->second) && args[k] != dest) {
+                rename[id->second] = args[k];
+                continue;
+            }
+            string name = g.name + "$" + params[k] + suffix.str();
+            declare(table, name, calleeTable->variableDict.find(params[k])->second);
+            rename[id->second] = f.symbol(name);
+            out.push_back(IRInst(IR_ASSIGN, args[k], IROperand(), rename[id->second]));
+        }
+
+        // ֲͷûȸֵ
+        for (size_t j = 0; j < g.names.size(); ++j) {
+            uint32_t id = static_cast<uint32_t>(j);
+            VariableDict::const_iterator v = calleeTable->variableDict.find(g.names[j]);
+            if (rename.count(id) || v == calleeTable->variableDict.end() ||
+                calleeTable->parametersDict.find(g.names[j]) != calleeTable->parametersDict.end()) {
+                continue;
+            }
+            string name = g.name + "$" + g.names[j] + suffix.str();
+            declare(table, name, v->second);
+            rename[id] = f.symbol(name);
+            if (!assignedFirst(g, id)) {
+                out.push_back(IRInst(IR_ASSIGN, IROperand::imm(0), IROperand(), rename[id]));
+            }
+        }
+
+        // û return ĺܴĩβ0
+        if (!dest.isNone() && g.code.back().opcode() != IR_RETURN) {
+            out.push_back(IRInst(IR_ASSIGN, IROperand::imm(0), IROperand(), dest));
+        }
+
+        uint32_t tempBase = nextTemp;
+        for (size_t i = 1; i < g.code.size(); ++i) {
+            const IRInst& inst = g.code[i];
+            if (inst.opcode() == IR_RETURN) {
+                if (!dest.isNone() && !inst.a.isNone()) {
+                    out.push_back(IRInst(IR_ASSIGN, translate(f, g, rename, tempBase, inst.a), IROperand(), dest));
+                }
+                continue;
+            }
+            IRInst copy = inst;
+            copy.a = translate(f, g, rename, tempBase, inst.a);
+            copy.b = translate(f, g, rename, tempBase, inst.b);
+            copy.r = translate(f, g, rename, tempBase, inst.r);
+            out.push_back(copy);
+        }
+        nextTemp = tempBase + g.tempCount();
     }
-};
 
+    static IROperand translate(IRFunction& f, const IRFunction& g, const map<uint32_t, IROperand>& rename,
+        uint32_t tempBase, IROperand o) {
+        switch (o.kind()) {
+        case IRO_TEMP:
+            return IROperand::make(IRO_TEMP, tempBase + o.index());
+        case IRO_CONST:
+            return f.constant(g.consts[o.index()]);
+        case IRO_SYM: {
+            map<uint32_t, IROperand>::const_iterator it = rename.find(o.index());
+            return it != rename.end() ? it->second : f.symbol(g.names[o.index()]);
+        }
+        default:
+            return o;
+        }
+    }
+};
 
 // ============================================================================
 // AsmCodeGen class - 8086 Assembly Code Generator
@@ -2977,12 +8950,15 @@ class AsmCodeGen {
 private:
     SYMBOL* symTable;
     vector<vector<vector<Quaternion> > > allCode;
+    vector<vector<set<string> > > allLiveOut;  // Per function: variables live at each block exit (may be empty)
     vector<string> allAsmCode;
     vector<vector<vector<string> > > funcsAsmCode;
     vector<vector<vector<string> > > mainAsmCode;
 
-    int id;  // Label generator
+    int id;  // Label generator, restarted for every function
+    string labelPrefix;  // Labels are "<function>_<kind><n>", so functions never share one
     map<string, string> op2asm;
+    map<string, int> sharedTemps;  // Temporaries live across blocks (hoisted out of loops) -> frame offset
 
     // Helper function: Check if string is a number
     bool isNumber(const string& str) {
@@ -3004,6 +8980,31 @@ private:
         return ss.str();
     }
 
+    // Helper function: Check if operator is a comparison
+    static bool isCompareOp(const string& op) {
+        return op == "<" || op == "<=" || op == ">" || op == ">=" || op == "==" || op == "!=";
+    }
+
+    // Helper function: Fused compare-and-branch (if<, do>= ...), cmpOp receives the comparison
+    static bool isFusedBranch(const string& op, string& cmpOp) {
+        IROpcode marker, cmp;
+        if (!IRAdapter::splitBranch(op, marker, cmp)) return false;
+        cmpOp = IR_OPCODE_NAMES[cmp];
+        return true;
+    }
+
+    // Helper function: Labels "L<n>" targeted by fused branches of one function
+    static set<string> branchTargets(const vector<vector<QuaternionExt> >& funcBlock) {
+        set<string> targets;
+        string cmpOp;
+        for (size_t i = 0; i < funcBlock.size(); ++i) {
+            for (size_t j = 0; j < funcBlock[i].size(); ++j) {
+                if (isFusedBranch(funcBlock[i][j].op.val, cmpOp)) targets.insert(funcBlock[i][j].result.val);
+            }
+        }
+        return targets;
+    }
+
     // Helper function: Parse array access
     void parseArrayAccess(const string& str, string& arrayName, string& index) {
         size_t leftBracket = str.find('[');
@@ -3019,11 +9020,18 @@ private:
         }
     }
 
+    // ֻңʱؿձɻʱűܱ̹߳ operator[] 룩
+    static const Variable& lookupVariable(const VariableDict& dict, const string& name) {
+        static const Variable empty;
+        VariableDict::const_iterator it = dict.find(name);
+        return it != dict.end() ? it->second : empty;
+    }
+
     // Get variable info from symbol table
     Variable* getVariableInfo(const string& varName, Function* funcTable) {
         // First check in function's local variables
         if (funcTable) {
-            map<string, Variable>::iterator it = funcTable->variableDict.find(varName);
+            VariableDict::iterator it = funcTable->variableDict.find(varName);
             if (it != funcTable->variableDict.end()) {
                 return &(it->second);
             }
@@ -3039,7 +9047,7 @@ private:
         }
 
         if (mainFunc && mainFunc != funcTable) {
-            map<string, Variable>::iterator it = mainFunc->variableDict.find(varName);
+            VariableDict::iterator it = mainFunc->variableDict.find(varName);
             if (it != mainFunc->variableDict.end()) {
                 return &(it->second);
             }
@@ -3106,7 +9114,7 @@ private:
                 }
 
                 if (st) {
-                    Variable& memberVar = st->variableDict[member];
+                    const Variable& memberVar = lookupVariable(st->variableDict, member);
 
                     // If member is array, load first element by default
                     res.push_back("MOV BX,OFFSET " + structVar);
@@ -3165,9 +9173,14 @@ private:
     vector<string> DOP_Main(const QtxInfo& op, const QtxInfo& operand) {
         vector<string> res;
 
+        // Temporaries live in the stack frame
+        string src = operand.val;
+        if (!src.empty() && src[0] == '@') {
+            src = "SS:[BP-" + toString(operand.addr1) + "]";
+        }
+
         // Compare operations
-        if (op.val == "<" || op.val == "<=" || op.val == ">" ||
-            op.val == ">=" || op.val == "==") {
+        if (isCompareOp(op.val)) {
 
             if (isNumber(operand.val)) {
                 res.push_back("CMP AX," + operand.val);
@@ -3189,7 +9202,7 @@ private:
                 }
             }
             else {
-                res.push_back("CMP AX," + operand.val);
+                res.push_back("CMP AX," + src);
             }
             res.push_back(op2asm[op.val] + " ");
         }
@@ -3215,7 +9228,7 @@ private:
                 }
             }
             else {
-                res.push_back(op2asm[op.val] + " AX," + operand.val);
+                res.push_back(op2asm[op.val] + " AX," + src);
             }
         }
         // Multiply/divide operations
@@ -3246,7 +9259,7 @@ private:
                 }
             }
             else {
-                res.push_back("MOV BX," + operand.val);
+                res.push_back("MOV BX," + src);
                 res.push_back(op2asm[op.val] + " BX");
             }
         }
@@ -3301,8 +9314,7 @@ private:
         vector<string> res;
 
         // Compare operations
-        if (op.val == "<" || op.val == "<=" || op.val == ">" ||
-            op.val == ">=" || op.val == "==") {
+        if (isCompareOp(op.val)) {
 
             if (isNumber(operand.val)) {
                 res.push_back("CMP AX," + operand.val);
@@ -3404,7 +9416,7 @@ private:
                 structVar = x.val.substr(0, dotPos);
                 member = x.val.substr(dotPos + 1);
 
-                Variable& varInfo = funcTable->variableDict[structVar];
+                const Variable& varInfo = lookupVariable(funcTable->variableDict, structVar);
                 int addr1 = varInfo.addr;
 
                 // Find struct in symbol table
@@ -3417,7 +9429,7 @@ private:
                 }
 
                 if (st) {
-                    int addr2 = st->variableDict[member].addr;
+                    int addr2 = lookupVariable(st->variableDict, member).addr;
 
                     if (addr1 < 0) {
                         res.addr1 = addr1 - 2;
@@ -3433,7 +9445,7 @@ private:
             }
             // Normal variable
             else if (funcTable->variableDict.find(x.val) != funcTable->variableDict.end()) {
-                Variable& varInfo = funcTable->variableDict[x.val];
+                const Variable& varInfo = lookupVariable(funcTable->variableDict, x.val);
                 int addr1 = varInfo.addr;
 
                 if (addr1 < 0) {
@@ -3449,8 +9461,9 @@ private:
 
         return res;
     }
-    // Improved liveness analysis that properly tracks variable usage
-    void actFunInfoGen(vector<QuaternionExt>& bloc, const string& funcName) {
+    // Improved liveness analysis that properly tracks variable usage; liveOut holds the
+    // function-wide liveness at the block exit when it is known
+    void actFunInfoGen(vector<QuaternionExt>& bloc, const string& funcName, const set<string>* liveOut) {
         map<string, bool> actTable;
 
         // Find function symbol table
@@ -3470,7 +9483,12 @@ private:
             maxSizeOfFunc = 0;
         }
 
-        map<string, int> t_table; // Temporary variable stack address storage
+        // Temporary variable stack address storage; temporaries shared between blocks
+        // keep one slot for the whole function
+        map<string, int> t_table = sharedTemps;
+        for (map<string, int>::const_iterator it = sharedTemps.begin(); it != sharedTemps.end(); ++it) {
+            maxSizeOfFunc = max(maxSizeOfFunc, it->second + 2);
+        }
 
         // First pass: collect all variables and initialize
         for (size_t i = 0; i < bloc.size(); ++i) {
@@ -3483,8 +9501,9 @@ private:
                 continue;
             }
 
-            // Process all variables in the quaternion
-            string vars[3] = { q.arg1.val, q.arg2.val, q.result.val };
+            // Process all variables in the quaternion (a fused branch's result is a label)
+            string cmpOp;
+            string vars[3] = { q.arg1.val, q.arg2.val, isFusedBranch(q.op.val, cmpOp) ? "_" : q.result.val };
 
             for (int k = 0; k < 3; k++) {
                 const string& var = vars[k];
@@ -3509,9 +9528,15 @@ private:
         // Backward liveness analysis
         set<string> liveVars;
 
-        // At basic block exit, non-temporary variables are live
+        // At basic block exit, temporaries and scalar variables are live if read later;
+        // without function-wide liveness, non-temporary variables and shared temporaries are live
+        set<string> scalars;
+        if (liveOut) {
+            scalars = Liveness::scalarVariables(*symTable, *funcTable);
+        }
         for (map<string, bool>::iterator it = actTable.begin(); it != actTable.end(); ++it) {
-            if (it->first[0] != '@') {
+            bool tracked = liveOut && (it->first[0] == '@' || scalars.count(it->first));
+            if (tracked ? liveOut->count(it->first) > 0 : it->first[0] != '@' || sharedTemps.count(it->first)) {
                 liveVars.insert(it->first);
                 it->second = true;
             }
@@ -3528,7 +9553,8 @@ private:
             }
 
             // Handle result (definition)
-            if (q.result.val != "_" && !isNumber(q.result.val)) {
+            string cmpOp;
+            if (q.result.val != "_" && !isNumber(q.result.val) && !isFusedBranch(q.op.val, cmpOp)) {
                 // Set activity based on whether it's in live set
                 if (liveVars.find(q.result.val) != liveVars.end()) {
                     actTable[q.result.val] = true;
@@ -3564,7 +9590,10 @@ private:
         // Apply helper function
         for (size_t i = 0; i < bloc.size(); ++i) {
             QuaternionExt& q = bloc[i];
-            q.result = helper(q.result, funcName, funcTable, actTable, t_table);
+            string cmpOp;
+            if (!isFusedBranch(q.op.val, cmpOp)) {
+                q.result = helper(q.result, funcName, funcTable, actTable, t_table);
+            }
             q.arg2 = helper(q.arg2, funcName, funcTable, actTable, t_table);
             q.arg1 = helper(q.arg1, funcName, funcTable, actTable, t_table);
             q.op = QtxInfo(q.op.val, false, 0, 0, false);
@@ -3572,6 +9601,64 @@ private:
     }
 
 
+    // Temporaries referenced from more than one basic block get a fixed frame slot
+    void collectSharedTemps(const vector<vector<Quaternion> >& funcBlock, const string& funcName) {
+        map<string, int> blockOf;
+        set<string> shared;
+        for (size_t i = 0; i < funcBlock.size(); ++i) {
+            for (size_t j = 0; j < funcBlock[i].size(); ++j) {
+                const Quaternion& q = funcBlock[i][j];
+                string cmpOp;
+                string vars[3] = { q.arg1, q.arg2, isFusedBranch(q.op, cmpOp) ? "_" : q.result };
+                for (int k = 0; k < 3; ++k) {
+                    if (vars[k].empty() || vars[k][0] != '@') continue;
+                    map<string, int>::iterator it = blockOf.find(vars[k]);
+                    if (it == blockOf.end()) blockOf[vars[k]] = static_cast<int>(i);
+                    else if (it->second != static_cast<int>(i)) shared.insert(vars[k]);
+                }
+            }
+        }
+
+        int base = 0;
+        for (size_t i = 0; i < symTable->functionList.size(); ++i) {
+            if (symTable->functionList[i]->functionName == funcName && funcName != "main") {
+                base = symTable->functionList[i]->totalSize;
+            }
+        }
+        sharedTemps.clear();
+        for (set<string>::const_iterator it = shared.begin(); it != shared.end(); ++it) {
+            sharedTemps[*it] = base;
+            base += 2;
+        }
+    }
+
+    // Function-wide liveness at each block exit, in the order of blockStarts; empty when
+    // the blocks were not split along the control flow graph
+    vector<set<string> > blockLiveOut(const IRFunction& fn) {
+        vector<set<string> > res;
+        Function* funcTable = NULL;
+        for (size_t i = 0; i < symTable->functionList.size(); ++i) {
+            if (symTable->functionList[i]->functionName == fn.name) funcTable = symTable->functionList[i];
+        }
+        if (!funcTable || fn.blockStarts.empty()) return res;
+
+        // main's variables are visible to callees and keep their final values
+        set<string> globals;
+        if (fn.name == "main") globals = Liveness::mainGlobals(Liveness::scalarVariables(*symTable, *funcTable));
+        ControlFlowGraph cfg(fn);
+        Liveness live(fn, cfg, globals, globals);
+        for (size_t b = 0; b < cfg.blocks.size(); ++b) {
+            if (cfg.blocks[b].first >= cfg.blocks[b].last) continue;
+            if (res.size() >= fn.blockStarts.size() ||
+                fn.blockStarts[res.size()] != static_cast<uint32_t>(cfg.blocks[b].first)) {
+                return vector<set<string> >();
+            }
+            res.push_back(live.liveOut[b]);
+        }
+        if (res.size() != fn.blockStarts.size()) res.clear();
+        return res;
+    }
+
     // Check if next instruction is a basic block exit
     bool isBasicBlockExit(const vector<QuaternionExt>& bloc, size_t index) {
         if (index >= bloc.size() - 1) return true;  // Last instruction in block
@@ -3582,6 +9669,20 @@ private:
                 nextOp == "do" || nextOp == "continue" || nextOp == "return");
     }
 
+    // Next label of the current function
+    string newLabel(const string& kind) {
+        return labelPrefix + "_" + kind + toString(id++);
+    }
+
+    // Turn "CMP ...; Jcc " (jump when the comparison is false) into 0/1 in AX
+    void materializeCompare(vector<string>& codes) {
+        string skip = newLabel("cmp");
+        codes.back() += skip;
+        codes.insert(codes.end() - 1, "MOV AX,0");
+        codes.push_back("MOV AX,1");
+        codes.push_back(skip + ":");
+    }
+
     // Store active variables at basic block exit
     void storeActiveVarsAtExit(QtxInfo* RDL, vector<string>& codes) {
         if (RDL && RDL->actInfo && RDL->val != "_" && RDL->val[0] != '@') {
@@ -3604,9 +9705,9 @@ private:
 
         // Control flow labels
         vector<string> startOfWhile;
-        vector<pair<int, int> > judgeOfWhile;
-        vector<pair<int, int> > judgeOfIf;
         vector<pair<int, int> > jmpToEnd;
+        set<string> targets = branchTargets(funcBlock);
+        int qtIndex = 0;
 
         for (size_t i = 0; i < funcBlock.size(); ++i) {
             const vector<QuaternionExt>& bloc = funcBlock[i];
@@ -3615,6 +9716,18 @@ private:
 
             for (size_t j = 0; j < bloc.size(); ++j) {
                 const QuaternionExt& item = bloc[j];
+                string cmpOp;
+
+                // Target of fused branches: the value in AX does not survive the jump
+                if (targets.count("L" + toString(qtIndex))) {
+                    if (RDL && RDL->actInfo) {
+                        vector<string> stCodes = ST_Main(*RDL);
+                        codes.insert(codes.end(), stCodes.begin(), stCodes.end());
+                    }
+                    codes.push_back(funcName + "_L" + toString(qtIndex) + ":");
+                    RDL = NULL;
+                }
+                qtIndex++;
 
                 // Operator processing
                 if (op2asm.find(item.op.val) != op2asm.end()) {
@@ -3635,28 +9748,37 @@ private:
                     vector<string> dopCodes = DOP_Main(item.op, item.arg2);
                     codes.insert(codes.end(), dopCodes.begin(), dopCodes.end());
 
-                    // For comparisons, handle jumps
-                    if (item.op.val == "<" || item.op.val == "<=" || item.op.val == ">" ||
-                        item.op.val == ">=" || item.op.val == "==") {
-                        if (!codes.empty() && codes[0].find("while") == 0) {
-                            judgeOfWhile.push_back(make_pair(asmCode.size(), codes.size() - 1));
-                        }
-                        else {
-                            judgeOfIf.push_back(make_pair(asmCode.size(), codes.size() - 1));
-                        }
-                        RDL = NULL;  // Comparison doesn't leave value in register
+                    // A comparison used as a value (not fused into a branch) leaves 0/1 in AX
+                    if (isCompareOp(item.op.val)) {
+                        materializeCompare(codes);
                     }
-                    else {
-                        // Result is in AX
-                        RDL = const_cast<QtxInfo*>(&item.result);
 
-                        // Store immediately if active
-                        if (RDL->actInfo) {
-                            vector<string> stCodes = ST_Main(*RDL);
-                            codes.insert(codes.end(), stCodes.begin(), stCodes.end());
-                            RDL = NULL;  // No longer in register after store
-                        }
+                    // Result is in AX
+                    RDL = const_cast<QtxInfo*>(&item.result);
+
+                    // Store immediately if active
+                    if (RDL->actInfo) {
+                        vector<string> stCodes = ST_Main(*RDL);
+                        codes.insert(codes.end(), stCodes.begin(), stCodes.end());
+                        RDL = NULL;  // No longer in register after store
+                    }
+                }
+                // Fused compare-and-branch: one CMP and one Jcc to the explicit target
+                else if (isFusedBranch(item.op.val, cmpOp)) {
+                    if (RDL && RDL->actInfo) {
+                        vector<string> stCodes = ST_Main(*RDL);
+                        codes.insert(codes.end(), stCodes.begin(), stCodes.end());
+                    }
+                    if (RDL == NULL || RDL->val != item.arg1.val) {
+                        vector<string> ldCodes = LD_Main(item.arg1, funcTable);
+                        codes.insert(codes.end(), ldCodes.begin(), ldCodes.end());
                     }
+                    QtxInfo cmp;
+                    cmp.val = cmpOp;
+                    vector<string> dopCodes = DOP_Main(cmp, item.arg2);
+                    codes.insert(codes.end(), dopCodes.begin(), dopCodes.end());
+                    codes.back() += funcName + "_" + item.result.val;
+                    RDL = NULL;
                 }
                 // Assignment operation
                 else if (item.op.val == "=") {
@@ -3698,11 +9820,6 @@ private:
                     }
                     codes.push_back("JMP ");
                     jmpToEnd.push_back(make_pair(asmCode.size(), codes.size() - 1));
-                    codes.push_back("next" + toString(id) + ":");
-                    pair<int, int> p = judgeOfIf.back();
-                    judgeOfIf.pop_back();
-                    asmCode[p.first][p.second] += "next" + toString(id);
-                    id++;
                     RDL = NULL;
                 }
                 else if (item.op.val == "elif") {
@@ -3717,13 +9834,13 @@ private:
                         vector<string> stCodes = ST_Main(*RDL);
                         codes.insert(codes.end(), stCodes.begin(), stCodes.end());
                     }
-                    codes.push_back("endif" + toString(id) + ":");
+                    string endLabel = newLabel("endif");
+                    codes.push_back(endLabel + ":");
                     while (!jmpToEnd.empty()) {
                         pair<int, int> p = jmpToEnd.back();
                         jmpToEnd.pop_back();
-                        asmCode[p.first][p.second] += "endif" + toString(id);
+                        asmCode[p.first][p.second] += endLabel;
                     }
-                    id++;
                     RDL = NULL;
                 }
                 else if (item.op.val == "wh") {
@@ -3731,9 +9848,9 @@ private:
                         vector<string> stCodes = ST_Main(*RDL);
                         codes.insert(codes.end(), stCodes.begin(), stCodes.end());
                     }
-                    codes.push_back("while" + toString(id) + ":");
-                    startOfWhile.push_back("while" + toString(id));
-                    id++;
+                    string top = newLabel("while");
+                    codes.push_back(top + ":");
+                    startOfWhile.push_back(top);
                     RDL = NULL;
                 }
                 else if (item.op.val == "we") {
@@ -3744,11 +9861,6 @@ private:
                     string tgt = startOfWhile.back();
                     startOfWhile.pop_back();
                     codes.push_back("JMP " + tgt);
-                    codes.push_back("endWhile" + toString(id) + ":");
-                    pair<int, int> p = judgeOfWhile.back();
-                    judgeOfWhile.pop_back();
-                    asmCode[p.first][p.second] += "endWhile" + toString(id);
-                    id++;
                     RDL = NULL;
                 }
                 else if (item.op.val == "push") {
@@ -3812,6 +9924,9 @@ private:
 
             asmCode.push_back(codes);
         }
+        if (targets.count("L" + toString(qtIndex)) && !asmCode.empty()) {
+            asmCode.back().push_back(funcName + "_L" + toString(qtIndex) + ":");
+        }
 
         return asmCode;
     }
@@ -3822,9 +9937,9 @@ private:
 
         // Control flow labels
         vector<string> startOfWhile;
-        vector<pair<int, int> > judgeOfWhile;
-        vector<pair<int, int> > judgeOfIf;
         vector<pair<int, int> > jmpToEnd;
+        set<string> targets = branchTargets(funcBlock);
+        int qtIndex = 0;
 
         for (size_t i = 0; i < funcBlock.size(); ++i) {
             const vector<QuaternionExt>& bloc = funcBlock[i];
@@ -3833,6 +9948,18 @@ private:
 
             for (size_t j = 0; j < bloc.size(); ++j) {
                 const QuaternionExt& item = bloc[j];
+                string cmpOp;
+
+                // Target of fused branches: the value in AX does not survive the jump
+                if (targets.count("L" + toString(qtIndex))) {
+                    if (RDL && RDL->actInfo) {
+                        vector<string> stCodes = ST_Func(*RDL);
+                        codes.insert(codes.end(), stCodes.begin(), stCodes.end());
+                    }
+                    codes.push_back(funcName + "_L" + toString(qtIndex) + ":");
+                    RDL = NULL;
+                }
+                qtIndex++;
 
                 // Operator processing
                 if (op2asm.find(item.op.val) != op2asm.end()) {
@@ -3851,26 +9978,35 @@ private:
                     vector<string> dopCodes = DOP_Func(item.op, item.arg2);
                     codes.insert(codes.end(), dopCodes.begin(), dopCodes.end());
 
-                    // Handle comparison or arithmetic result
-                    if (item.op.val == "<" || item.op.val == "<=" || item.op.val == ">" ||
-                        item.op.val == ">=" || item.op.val == "==") {
-                        if (!codes.empty() && codes[0].find("while") == 0) {
-                            judgeOfWhile.push_back(make_pair(asmCode.size(), codes.size() - 1));
-                        }
-                        else {
-                            judgeOfIf.push_back(make_pair(asmCode.size(), codes.size() - 1));
-                        }
+                    // A comparison used as a value (not fused into a branch) leaves 0/1 in AX
+                    if (isCompareOp(item.op.val)) {
+                        materializeCompare(codes);
+                    }
+
+                    RDL = const_cast<QtxInfo*>(&item.result);
+                    // Store immediately if active
+                    if (RDL->actInfo) {
+                        vector<string> stCodes = ST_Func(*RDL);
+                        codes.insert(codes.end(), stCodes.begin(), stCodes.end());
                         RDL = NULL;
                     }
-                    else {
-                        RDL = const_cast<QtxInfo*>(&item.result);
-                        // Store immediately if active
-                        if (RDL->actInfo) {
-                            vector<string> stCodes = ST_Func(*RDL);
-                            codes.insert(codes.end(), stCodes.begin(), stCodes.end());
-                            RDL = NULL;
-                        }
+                }
+                // Fused compare-and-branch: one CMP and one Jcc to the explicit target
+                else if (isFusedBranch(item.op.val, cmpOp)) {
+                    if (RDL && RDL->actInfo) {
+                        vector<string> stCodes = ST_Func(*RDL);
+                        codes.insert(codes.end(), stCodes.begin(), stCodes.end());
                     }
+                    if (RDL == NULL || RDL->val != item.arg1.val) {
+                        vector<string> ldCodes = LD_Func(item.arg1);
+                        codes.insert(codes.end(), ldCodes.begin(), ldCodes.end());
+                    }
+                    QtxInfo cmp;
+                    cmp.val = cmpOp;
+                    vector<string> dopCodes = DOP_Func(cmp, item.arg2);
+                    codes.insert(codes.end(), dopCodes.begin(), dopCodes.end());
+                    codes.back() += funcName + "_" + item.result.val;
+                    RDL = NULL;
                 }
                 // Assignment operation
                 else if (item.op.val == "=") {
@@ -3948,11 +10084,6 @@ private:
                     }
                     codes.push_back("JMP ");
                     jmpToEnd.push_back(make_pair(asmCode.size(), codes.size() - 1));
-                    codes.push_back("next" + toString(id) + ":");
-                    pair<int, int> p = judgeOfIf.back();
-                    judgeOfIf.pop_back();
-                    asmCode[p.first][p.second] += "next" + toString(id);
-                    id++;
                     RDL = NULL;
                 }
                 else if (item.op.val == "elif") {
@@ -3967,13 +10098,13 @@ private:
                         vector<string> stCodes = ST_Func(*RDL);
                         codes.insert(codes.end(), stCodes.begin(), stCodes.end());
                     }
-                    codes.push_back("endif" + toString(id) + ":");
+                    string endLabel = newLabel("endif");
+                    codes.push_back(endLabel + ":");
                     while (!jmpToEnd.empty()) {
                         pair<int, int> p = jmpToEnd.back();
                         jmpToEnd.pop_back();
-                        asmCode[p.first][p.second] += "endif" + toString(id);
+                        asmCode[p.first][p.second] += endLabel;
                     }
-                    id++;
                     RDL = NULL;
                 }
                 else if (item.op.val == "wh") {
@@ -3981,9 +10112,9 @@ private:
                         vector<string> stCodes = ST_Func(*RDL);
                         codes.insert(codes.end(), stCodes.begin(), stCodes.end());
                     }
-                    codes.push_back("while" + toString(id) + ":");
-                    startOfWhile.push_back("while" + toString(id));
-                    id++;
+                    string top = newLabel("while");
+                    codes.push_back(top + ":");
+                    startOfWhile.push_back(top);
                     RDL = NULL;
                 }
                 else if (item.op.val == "we") {
@@ -3994,11 +10125,6 @@ private:
                     string tgt = startOfWhile.back();
                     startOfWhile.pop_back();
                     codes.push_back("JMP " + tgt);
-                    codes.push_back("endWhile" + toString(id) + ":");
-                    pair<int, int> p = judgeOfWhile.back();
-                    judgeOfWhile.pop_back();
-                    asmCode[p.first][p.second] += "endWhile" + toString(id);
-                    id++;
                     RDL = NULL;
                 }
                 else if (item.op.val == "push") {
@@ -4039,13 +10165,16 @@ private:
 
             asmCode.push_back(codes);
         }
+        if (targets.count("L" + toString(qtIndex)) && !asmCode.empty()) {
+            asmCode.back().push_back(funcName + "_L" + toString(qtIndex) + ":");
+        }
 
         return asmCode;
     }
 
 
     // Process function block
-    void getAsm(const vector<vector<Quaternion> >& funcBlock) {
+    void getAsm(const vector<vector<Quaternion> >& funcBlock, const vector<set<string> >& liveOut) {
         if (funcBlock.empty() || funcBlock[0].empty()) return;
 
         // Convert to extended quaternion format
@@ -4059,11 +10188,14 @@ private:
         }
 
         string funcName = funcBlock[0][0].arg1;
+        labelPrefix = funcName;
+        id = 0;
+        collectSharedTemps(funcBlock, funcName);
 
         if (funcName != "main") {
             // Add activity info for each basic block
             for (size_t i = 0; i < extFuncBlock.size(); ++i) {
-                actFunInfoGen(extFuncBlock[i], funcName);
+                actFunInfoGen(extFuncBlock[i], funcName, i < liveOut.size() ? &liveOut[i] : NULL);
             }
             vector<vector<string> > res = genFunAsm(extFuncBlock, funcName);
             funcsAsmCode.push_back(res);
@@ -4071,7 +10203,7 @@ private:
         else {
             // Main function processing
             for (size_t i = 0; i < extFuncBlock.size(); ++i) {
-                actFunInfoGen(extFuncBlock[i], funcName);
+                actFunInfoGen(extFuncBlock[i], funcName, i < liveOut.size() ? &liveOut[i] : NULL);
             }
             vector<vector<string> > res = genMainAsm(extFuncBlock, funcName);
             mainAsmCode.push_back(res);
@@ -4087,7 +10219,7 @@ private:
 
             // Create a vector to sort members by address
             vector<pair<int, Variable*> > sortedMembers;
-            for (map<string, Variable>::iterator it = st->variableDict.begin();
+            for (VariableDict::iterator it = st->variableDict.begin();
                 it != st->variableDict.end(); ++it) {
                 sortedMembers.push_back(make_pair(it->second.addr, &(it->second)));
             }
@@ -4125,149 +10257,970 @@ private:
                 }
             }
 
-            allAsmCode.push_back(st->structName + " ENDS");
+            allAsmCode.push_back(st->structName + " ENDS");
+        }
+
+        // Generate data segment
+        allAsmCode.push_back("DSEG SEGMENT");
+
+        // Find main function
+        Function* mainFunc = NULL;
+        for (size_t i = 0; i < symTable->functionList.size(); ++i) {
+            if (symTable->functionList[i]->functionName == "main") {
+                mainFunc = symTable->functionList[i];
+                break;
+            }
+        }
+
+        if (mainFunc) {
+            // Sort variables by address to maintain declaration order
+            vector<pair<int, Variable*> > sortedVars;
+            for (VariableDict::iterator it = mainFunc->variableDict.begin();
+                it != mainFunc->variableDict.end(); ++it) {
+                sortedVars.push_back(make_pair(it->second.addr, &(it->second)));
+            }
+            sort(sortedVars.begin(), sortedVars.end());
+
+            for (size_t i = 0; i < sortedVars.size(); ++i) {
+                Variable* v = sortedVars[i].second;
+
+                if (v->type == "int" && !v->isArray) {
+                    allAsmCode.push_back(v->name + " dw ?");
+                }
+                else if (v->type == "float" && !v->isArray) {
+                    allAsmCode.push_back(v->name + " dd ?");
+                }
+                else if (v->type == "char" && !v->isArray) {
+                    allAsmCode.push_back(v->name + " db ?");
+                }
+                else if (v->isArray) {
+                    string sizeSpec = "";
+                    if (v->type == "int") sizeSpec = "dw";
+                    else if (v->type == "float") sizeSpec = "dd";
+                    else if (v->type == "char") sizeSpec = "db";
+                    else sizeSpec = "db";
+
+                    allAsmCode.push_back(v->name + " " + sizeSpec + " " +
+                        toString(v->arraySize) + " DUP (0)");
+                }
+                else {
+                    // Struct variable
+                    allAsmCode.push_back(v->name + " " + v->type + " <?>");
+                }
+            }
+        }
+
+        allAsmCode.push_back("DSEG ENDS");
+
+        // Generate stack segment
+        allAsmCode.push_back("SSEG SEGMENT STACK");
+        allAsmCode.push_back("STK DB 40 DUP (0)");
+        allAsmCode.push_back("SSEG ENDS");
+
+        // Generate code segment
+        allAsmCode.push_back("CSEG SEGMENT");
+        allAsmCode.push_back("ASSUME CS:CSEG,DS:DSEG,SS:SSEG");
+
+        // Add main function code first
+        for (size_t i = 0; i < mainAsmCode.size(); ++i) {
+            for (size_t j = 0; j < mainAsmCode[i].size(); ++j) {
+                for (size_t k = 0; k < mainAsmCode[i][j].size(); ++k) {
+                    allAsmCode.push_back(mainAsmCode[i][j][k]);
+                }
+            }
+        }
+
+        // Add other function code BEFORE closing the segment
+        for (size_t i = 0; i < funcsAsmCode.size(); ++i) {
+            for (size_t j = 0; j < funcsAsmCode[i].size(); ++j) {
+                for (size_t k = 0; k < funcsAsmCode[i][j].size(); ++k) {
+                    allAsmCode.push_back(funcsAsmCode[i][j][k]);
+                }
+            }
+        }
+
+        // Close code segment properly
+        allAsmCode.push_back("CSEG ENDS");
+        allAsmCode.push_back("END main");
+    }
+
+public:
+    // Constructor
+    AsmCodeGen(SYMBOL* sym, const vector<vector<vector<Quaternion> > >& code)
+        : symTable(sym), allCode(code), id(0) {
+        generate();
+    }
+
+    // Compact IR input: each function's basic blocks are recovered from blockStarts.
+    // With a thread pool, functions are translated concurrently (see generate)
+    AsmCodeGen(SYMBOL* sym, const vector<IRFunction*>& code, ThreadPool* pool = NULL)
+        : symTable(sym), id(0) {
+        for (size_t i = 0; i < code.size(); ++i) {
+            allCode.push_back(IRAdapter::toBlocks(*code[i]));
+            allLiveOut.push_back(blockLiveOut(*code[i]));
+        }
+        generate(pool);
+    }
+
+private:
+    // Worker for one function
+    explicit AsmCodeGen(SYMBOL* sym)
+        : symTable(sym), id(0) {
+        initOpMap();
+    }
+
+    const vector<set<string> >& liveOutOf(size_t i) const {
+        static const vector<set<string> > unknown;
+        return i < allLiveOut.size() ? allLiveOut[i] : unknown;
+    }
+
+    void generate(ThreadPool* pool = NULL) {
+        initOpMap();
+
+        // Generate assembly code for all functions
+        if (pool && allCode.size() > 1) {
+            // Labels are numbered per function, so workers need no shared counter
+            vector<AsmCodeGen*> workers(allCode.size(), static_cast<AsmCodeGen*>(NULL));
+            pool->run(allCode.size(), [&](size_t i) {
+                workers[i] = new AsmCodeGen(symTable);
+                workers[i]->getAsm(allCode[i], liveOutOf(i));
+            });
+
+            // Merge in function order
+            for (size_t i = 0; i < workers.size(); ++i) {
+                AsmCodeGen* w = workers[i];
+                funcsAsmCode.insert(funcsAsmCode.end(), w->funcsAsmCode.begin(), w->funcsAsmCode.end());
+                mainAsmCode.insert(mainAsmCode.end(), w->mainAsmCode.begin(), w->mainAsmCode.end());
+                delete w;
+            }
+        }
+        else {
+            for (size_t i = 0; i < allCode.size(); ++i) {
+                getAsm(allCode[i], liveOutOf(i));
+            }
+        }
+
+        // Generate complete assembly program
+        getAll();
+    }
+
+    void initOpMap() {
+        // Initialize operator mapping
+        op2asm["+"] = "ADD";
+        op2asm["-"] = "SUB";
+        op2asm["*"] = "MUL";
+        op2asm["/"] = "DIV";
+        op2asm["<"] = "JAE";
+        op2asm[">"] = "JBE";
+        op2asm[">="] = "JB";
+        op2asm["<="] = "JA";
+        op2asm["=="] = "JNE";
+        op2asm["!="] = "JE";
+    }
+
+public:
+    // Get generated assembly code
+    vector<string> getGeneratedCode() const {
+        return allAsmCode;
+    }
+
+    // Print generated assembly code
+    void printAsmCode() const {
+        cout << "\n=== Generated 8086 Assembly Code ===" << endl;
+        for (size_t i = 0; i < allAsmCode.size(); ++i) {
+            cout << allAsmCode[i] << endl;
+        }
+    }
+
+    // Write assembly code to file
+    void writeToFile(const string& filename) const {
+        ofstream outFile(filename.c_str());
+        if (outFile.is_open()) {
+            for (size_t i = 0; i < allAsmCode.size(); ++i) {
+                outFile << allAsmCode[i] << endl;
+            }
+            outFile.close();
+            cout << "[DEBUG] Assembly code written to: " << filename << endl;
+        }
+        else {
+            cout << "[ERROR] Could not create output file: " << filename << endl;
+        }
+    }
+};
+
+// ============================================================================
+// X64AsmGen class - x86-64 GNU assembler backend (System V ABI)
+// Emits Intel-syntax GNU as code from the same optimized function IR as
+// AsmCodeGen, together with a tiny freestanding runtime (_start, integer
+// printing and error exits through Linux system calls), so the output links
+// into a static ELF without libc:
+//     as -o prog.o output.s && ld -o prog prog.o && ./prog
+// The program prints main's return value. main's variables live in .bss (they
+// are the program's globals); every other function keeps its parameters,
+// variables and temporaries in an rbp frame. Arguments are passed in rdi, rsi,
+// rdx, rcx, r8, r9 and then on the stack, results are returned in rax, and
+// arrays and structs are passed by address. Integer programs only.
+// r14 and r15 are reserved for the whole program: the lowest rsp allowed and the
+// current call depth. Every function except main checks both on entry, so deep
+// recursion ends with the same "call stack overflow" error as the VM and JIT.
+// ============================================================================
+class X64AsmGen {
+public:
+    string error;   // why the program cannot be compiled, empty on success
+
+    X64AsmGen(SYMBOL* sym, const vector<IRFunction*>& program) : symTable(sym), fn(NULL), fnIndex(0) {
+        for (size_t i = 0; i < program.size(); ++i) {
+            Function* table = findTable(program[i]->name);
+            paramCounts[program[i]->name] = table && program[i]->name != "main"
+                ? static_cast<int>(IRInterpreter::parameterNames(table).size()) : 0;
+        }
+        if (paramCounts.find("main") == paramCounts.end()) {
+            error = "no main function";
+            return;
+        }
+
+        emit("# Generated by the c_like compiler: x86-64, System V ABI, GNU as");
+        emit("# Build: as -o prog.o output.s && ld -o prog prog.o");
+        emit("    .intel_syntax noprefix");
+        emitGlobals();
+        emitRuntime();
+        for (size_t i = 0; i < program.size() && error.empty(); ++i) {
+            fnIndex = static_cast<int>(i);
+            genFunction(*program[i]);
+        }
+    }
+
+    size_t lineCount() const {
+        return lines.size();
+    }
+
+    void writeToFile(const string& filename) const {
+        if (!error.empty()) {
+            cout << "[ERROR] x86-64 code generation failed: " << error << endl;
+            return;
+        }
+        ofstream outFile(filename.c_str());
+        if (outFile.is_open()) {
+            for (size_t i = 0; i < lines.size(); ++i) {
+                outFile << lines[i] << "\n";
+            }
+            outFile.close();
+            cout << "[DEBUG] x86-64 assembly written to: " << filename << endl;
+        }
+        else {
+            cout << "[ERROR] Could not create output file: " << filename << endl;
+        }
+    }
+
+private:
+    // Where a variable lives
+    struct Storage {
+        string symbol;          // .bss label of a global, empty for frame storage
+        int offset;             // rbp offset of element 0 (frame storage)
+        int length;             // element count of an aggregate, 0 for scalars, -1 unknown
+        bool pointer;           // aggregate parameter: the slot holds the argument's address
+        const Struct* type;
+
+        Storage() : offset(0), length(0), pointer(false), type(NULL) {}
+        bool aggregate() const { return length != 0; }
+    };
+
+    typedef map<string, Storage> StorageMap;
+
+    SYMBOL* symTable;
+    vector<string> lines;
+    StorageMap globals;
+    map<string, int> paramCounts;
+
+    // Per-function state
+    const IRFunction* fn;
+    int fnIndex;
+    StorageMap locals;
+    map<uint32_t, int> temps;
+    int frameBytes;
+    vector<string> body;
+    vector<IROperand> pendingArgs;
+
+    static const char* const ARG_REGS[6];
+
+    void emit(const string& line) {
+        lines.push_back(line);
+    }
+
+    void code(const string& line) {
+        body.push_back("    " + line);
+    }
+
+    bool fail(const string& msg) {
+        if (error.empty()) error = msg;
+        return false;
+    }
+
+    Function* findTable(const string& name) const {
+        for (size_t j = 0; j < symTable->functionList.size(); ++j) {
+            if (symTable->functionList[j]->functionName == name) {
+                return symTable->functionList[j];
+            }
+        }
+        return NULL;
+    }
+
+    const Struct* findStruct(const string& name) const {
+        for (size_t j = 0; j < symTable->structList.size(); ++j) {
+            if (symTable->structList[j]->structName == name) {
+                return symTable->structList[j];
+            }
+        }
+        return NULL;
+    }
+
+    // Struct members take one 8-byte slot each, in declaration (address) order
+    static int memberIndex(const Struct* st, const string& member) {
+        VariableDict::const_iterator target = st->variableDict.find(member);
+        if (target == st->variableDict.end() || target->second.isArray) return -1;
+        int index = 0;
+        for (VariableDict::const_iterator it = st->variableDict.begin(); it != st->variableDict.end(); ++it) {
+            if (it->second.addr < target->second.addr) index++;
+        }
+        return index;
+    }
+
+    static string num(long long v) {
+        stringstream ss;
+        ss << v;
+        return ss.str();
+    }
+
+    // "+16" / "-24" for address arithmetic
+    static string disp(long long v) {
+        return v < 0 ? num(v) : "+" + num(v);
+    }
+
+    string label(int irIndex) const {
+        return ".L" + num(fnIndex) + "_" + num(irIndex);
+    }
+
+    // Element count of a variable: 0 for scalars, member count for structs
+    int elementCount(const Variable& v, const Struct* type) {
+        if (v.isArray) {
+            if (type) fail("arrays of structs are not supported: " + v.name);
+            return v.arraySize > 0 ? v.arraySize : -1;
+        }
+        return type ? static_cast<int>(type->variableDict.size()) : 0;
+    }
+
+    // ---------------- Data and runtime ----------------
+    void emitGlobals() {
+        Function* mainTable = findTable("main");
+        emit("");
+        emit("    .section .rodata");
+        emit("__c5_msg_div: .ascii \"runtime error: division by zero\\n\"");
+        emit("    .equ __c5_msg_div_len, . - __c5_msg_div");
+        emit("__c5_msg_bounds: .ascii \"runtime error: array index out of range\\n\"");
+        emit("    .equ __c5_msg_bounds_len, . - __c5_msg_bounds");
+        emit("__c5_msg_stack: .ascii \"runtime error: call stack overflow in \"");
+        emit("    .equ __c5_msg_stack_len, . - __c5_msg_stack");
+        emit("");
+        emit("    .bss");
+        emit("    .align 8");
+        if (!mainTable) return;
+        for (VariableDict::const_iterator it = mainTable->variableDict.begin();
+            it != mainTable->variableDict.end(); ++it) {
+            Storage s;
+            s.symbol = "__g_" + it->first;
+            s.type = findStruct(it->second.type);
+            s.length = elementCount(it->second, s.type);
+            globals[it->first] = s;
+            emit(s.symbol + ": .zero " + num(8 * max(1, s.length)));
+        }
+    }
+
+    void emitRuntime() {
+        static const char* const runtime[] = {
+            "",
+            "    .text",
+            "    .globl _start",
+            "_start:",
+            "    xor ebp, ebp",
+            "    and rsp, -16",
+            "# Stack budget: the soft RLIMIT_STACK (8 MiB if unavailable, at most 1 GiB)",
+            "# less 256 KiB for the environment and the runtime",
+            "    sub rsp, 16",
+            "    mov eax, 97",
+            "    mov edi, 3",
+            "    mov rsi, rsp",
+            "    syscall",
+            "    mov rcx, QWORD PTR [rsp]",
+            "    add rsp, 16",
+            "    test rax, rax",
+            "    jz 1f",
+            "    mov ecx, 0x800000",
+            "1:  mov eax, 0x40000000",
+            "    cmp rcx, rax",
+            "    cmova rcx, rax",
+            "    sub rcx, 0x40000",
+            "    mov rax, rsp",
+            "    sub rax, rcx",
+            "    mov r14, rax",
+            "    xor r15d, r15d",
+            "    call main",
+            "    mov rdi, rax",
+            "    call __c5_print_int",
+            "    mov eax, 60",
+            "    xor edi, edi",
+            "    syscall",
+            "",
+            "# Print rdi as a signed decimal number and a newline on stdout",
+            "__c5_print_int:",
+            "    sub rsp, 40",
+            "    mov rax, rdi",
+            "    lea rsi, [rsp+32]",
+            "    mov BYTE PTR [rsi], 10",
+            "    mov r8, rdi",
+            "    test rax, rax",
+            "    jns 1f",
+            "    neg rax",
+            "1:  mov ecx, 10",
+            "2:  xor edx, edx",
+            "    div rcx",
+            "    add dl, 48",
+            "    dec rsi",
+            "    mov BYTE PTR [rsi], dl",
+            "    test rax, rax",
+            "    jnz 2b",
+            "    test r8, r8",
+            "    jns 3f",
+            "    dec rsi",
+            "    mov BYTE PTR [rsi], 45",
+            "3:  mov eax, 1",
+            "    mov edi, 1",
+            "    lea rdx, [rsp+33]",
+            "    sub rdx, rsi",
+            "    syscall",
+            "    add rsp, 40",
+            "    ret",
+            "",
+            "__c5_div_zero:",
+            "    lea rsi, [rip+__c5_msg_div]",
+            "    mov edx, __c5_msg_div_len",
+            "    jmp __c5_fail",
+            "__c5_bounds:",
+            "    lea rsi, [rip+__c5_msg_bounds]",
+            "    mov edx, __c5_msg_bounds_len",
+            "    jmp __c5_fail",
+            "# rsi/rdx: name of the function that could not be entered",
+            "__c5_overflow:",
+            "    mov r12, rsi",
+            "    mov r13, rdx",
+            "    mov eax, 1",
+            "    mov edi, 2",
+            "    lea rsi, [rip+__c5_msg_stack]",
+            "    mov edx, __c5_msg_stack_len",
+            "    syscall",
+            "    mov rsi, r12",
+            "    mov rdx, r13",
+            "__c5_fail:",
+            "    mov eax, 1",
+            "    mov edi, 2",
+            "    syscall",
+            "    mov eax, 60",
+            "    mov edi, 1",
+            "    syscall",
+            NULL
+        };
+        for (int i = 0; runtime[i]; ++i) {
+            emit(runtime[i]);
+        }
+    }
+
+    // ---------------- Frame layout ----------------
+    int allocate(int slots) {
+        frameBytes += 8 * slots;
+        return -frameBytes;
+    }
+
+    void layoutFrame(Function* table) {
+        locals.clear();
+        temps.clear();
+        frameBytes = 0;
+        if (!table || fn->name == "main") return;
+
+        vector<string> params = IRInterpreter::parameterNames(table);
+        for (size_t k = 0; k < params.size(); ++k) {
+            const Variable& v = table->parametersDict.find(params[k])->second;
+            Storage s;
+            s.type = findStruct(v.type);
+            s.length = elementCount(v, s.type);
+            s.pointer = s.aggregate();
+            // Register arguments are spilled below rbp, stack arguments stay above it
+            s.offset = k < 6 ? allocate(1) : 16 + 8 * static_cast<int>(k - 6);
+            locals[params[k]] = s;
+        }
+        for (VariableDict::const_iterator it = table->variableDict.begin();
+            it != table->variableDict.end(); ++it) {
+            if (locals.find(it->first) != locals.end()) continue;
+            Storage s;
+            s.type = findStruct(it->second.type);
+            s.length = elementCount(it->second, s.type);
+            s.offset = allocate(max(1, s.length));
+            locals[it->first] = s;
         }
+    }
 
-        // Generate data segment
-        allAsmCode.push_back("DSEG SEGMENT");
+    const Storage* locate(const string& name) {
+        StorageMap::const_iterator it = locals.find(name);
+        if (it != locals.end()) return &it->second;
+        it = globals.find(name);
+        if (it != globals.end()) return &it->second;
+        fail("unknown variable " + name + " in " + fn->name);
+        return NULL;
+    }
 
-        // Find main function
-        Function* mainFunc = NULL;
-        for (size_t i = 0; i < symTable->functionList.size(); ++i) {
-            if (symTable->functionList[i]->functionName == "main") {
-                mainFunc = symTable->functionList[i];
-                break;
+    // ---------------- Operands ----------------
+    // Integer value of a constant operand
+    bool constantValue(IROperand o, long long& value) {
+        if (o.kind() == IRO_IMM) {
+            value = o.immValue();
+            return true;
+        }
+        if (o.kind() == IRO_CONST) {
+            string text = fn->consts[o.index()];
+            if (text.find_first_of(".eE") != string::npos) {
+                fail("floating-point constant " + text + " is not supported");
+            }
+            value = atoll(text.c_str());
+            return true;
+        }
+        if (o.kind() == IRO_SYM) {
+            const char* text = fn->names[o.index()];
+            if (text[0] == '\'' && text[1] && text[2] == '\'') {
+                value = static_cast<unsigned char>(text[1]);
+                return true;
             }
         }
+        return false;
+    }
 
-        if (mainFunc) {
-            // Sort variables by address to maintain declaration order
-            vector<pair<int, Variable*> > sortedVars;
-            for (map<string, Variable>::iterator it = mainFunc->variableDict.begin();
-                it != mainFunc->variableDict.end(); ++it) {
-                sortedVars.push_back(make_pair(it->second.addr, &(it->second)));
-            }
-            sort(sortedVars.begin(), sortedVars.end());
-
-            for (size_t i = 0; i < sortedVars.size(); ++i) {
-                Variable* v = sortedVars[i].second;
+    static bool fitsInt32(long long v) {
+        return v >= -2147483647LL - 1 && v <= 2147483647LL;
+    }
 
-                if (v->type == "int" && !v->isArray) {
-                    allAsmCode.push_back(v->name + " dw ?");
-                }
-                else if (v->type == "float" && !v->isArray) {
-                    allAsmCode.push_back(v->name + " dd ?");
-                }
-                else if (v->type == "char" && !v->isArray) {
-                    allAsmCode.push_back(v->name + " db ?");
-                }
-                else if (v->isArray) {
-                    string sizeSpec = "";
-                    if (v->type == "int") sizeSpec = "dw";
-                    else if (v->type == "float") sizeSpec = "dd";
-                    else if (v->type == "char") sizeSpec = "db";
-                    else sizeSpec = "db";
+    void boundsCheck(int length) {
+        if (length > 0) {
+            code("cmp rcx, " + num(length));
+            code("jae __c5_bounds");
+        }
+        else {
+            code("test rcx, rcx");
+            code("js __c5_bounds");
+        }
+    }
 
-                    allAsmCode.push_back(v->name + " " + sizeSpec + " " +
-                        toString(v->arraySize) + " DUP (0)");
-                }
-                else {
-                    // Struct variable
-                    allAsmCode.push_back(v->name + " " + v->type + " <?>");
-                }
+    // Memory operand of a variable, array element or struct member.
+    // Dynamic indices are loaded into rcx and pointer/global bases into rdx.
+    string memory(IROperand o) {
+        if (o.kind() == IRO_TEMP) {
+            map<uint32_t, int>::const_iterator it = temps.find(o.index());
+            int offset = it != temps.end() ? it->second : (temps[o.index()] = allocate(1));
+            return "QWORD PTR [rbp" + disp(offset) + "]";
+        }
+        if (o.kind() == IRO_SYM) {
+            string name = fn->names[o.index()];
+            if (name.find_first_of(".[") != string::npos) {
+                fail("unsupported operand " + name);
+                return "";
+            }
+            const Storage* s = locate(name);
+            if (!s) return "";
+            if (s->aggregate()) {
+                fail("aggregate " + name + " used as a value");
+                return "";
             }
+            return s->symbol.empty() ? "QWORD PTR [rbp" + disp(s->offset) + "]"
+                : "QWORD PTR [rip+" + s->symbol + "]";
+        }
+        if (o.kind() != IRO_REF) {
+            fail("unsupported operand " + fn->operandText(o));
+            return "";
         }
 
-        allAsmCode.push_back("DSEG ENDS");
-
-        // Generate stack segment
-        allAsmCode.push_back("SSEG SEGMENT STACK");
-        allAsmCode.push_back("STK DB 40 DUP (0)");
-        allAsmCode.push_back("SSEG ENDS");
-
-        // Generate code segment
-        allAsmCode.push_back("CSEG SEGMENT");
-        allAsmCode.push_back("ASSUME CS:CSEG,DS:DSEG,SS:SSEG");
+        const IRRef& ref = fn->refs[o.index()];
+        const Storage* s = locate(fn->names[ref.base]);
+        if (!s) return "";
+        if (!s->aggregate()) {
+            fail(string(fn->names[ref.base]) + " is not an array or struct");
+            return "";
+        }
 
-        // Add main function code first
-        for (size_t i = 0; i < mainAsmCode.size(); ++i) {
-            for (size_t j = 0; j < mainAsmCode[i].size(); ++j) {
-                for (size_t k = 0; k < mainAsmCode[i][j].size(); ++k) {
-                    allAsmCode.push_back(mainAsmCode[i][j][k]);
-                }
+        int offset = 0;
+        bool dynamic = false;
+        if (ref.member != IR_NO_MEMBER) {
+            int m = s->type ? memberIndex(s->type, fn->names[ref.member]) : -1;
+            if (m < 0) {
+                fail("unsupported member access " + fn->operandText(o));
+                return "";
             }
+            offset = 8 * m;
         }
-
-        // Add other function code BEFORE closing the segment
-        for (size_t i = 0; i < funcsAsmCode.size(); ++i) {
-            for (size_t j = 0; j < funcsAsmCode[i].size(); ++j) {
-                for (size_t k = 0; k < funcsAsmCode[i][j].size(); ++k) {
-                    allAsmCode.push_back(funcsAsmCode[i][j][k]);
-                }
+        else if (ref.index.kind() == IRO_IMM) {
+            int index = ref.index.immValue();
+            if (index < 0 || (s->length > 0 && index >= s->length)) {
+                fail("array index out of range: " + fn->operandText(o));
+                return "";
             }
+            offset = 8 * index;
+        }
+        else {
+            load("rcx", ref.index);
+            boundsCheck(s->length);
+            dynamic = true;
         }
 
-        // Close code segment properly
-        allAsmCode.push_back("CSEG ENDS");
-        allAsmCode.push_back("END main");
+        string index = dynamic ? "+rcx*8" : "";
+        if (s->pointer) {
+            code("mov rdx, QWORD PTR [rbp" + disp(s->offset) + "]");
+            return "QWORD PTR [rdx" + index + disp(offset) + "]";
+        }
+        if (!s->symbol.empty()) {
+            if (!dynamic) return "QWORD PTR [rip+" + s->symbol + disp(offset) + "]";
+            code("lea rdx, [rip+" + s->symbol + "]");
+            return "QWORD PTR [rdx" + index + disp(offset) + "]";
+        }
+        return "QWORD PTR [rbp" + index + disp(s->offset + offset) + "]";
     }
 
-public:
-    // Constructor
-    AsmCodeGen(SYMBOL* sym, const vector<vector<vector<Quaternion> > >& code)
-        : symTable(sym), allCode(code), id(0) {
-
-        // Initialize operator mapping
-        op2asm["+"] = "ADD";
-        op2asm["-"] = "SUB";
-        op2asm["*"] = "MUL";
-        op2asm["/"] = "DIV";
-        op2asm["<"] = "JAE";
-        op2asm[">"] = "JBE";
-        op2asm[">="] = "JB";
-        op2asm["<="] = "JA";
-        op2asm["=="] = "JNE";
+    void load(const string& reg, IROperand o) {
+        long long value;
+        if (constantValue(o, value)) {
+            if (value == 0) code("xor " + reg + ", " + reg);
+            else code(string(fitsInt32(value) ? "mov " : "movabs ") + reg + ", " + num(value));
+            return;
+        }
+        code("mov " + reg + ", " + memory(o));
+    }
 
-        // Generate assembly code for all functions
-        for (size_t i = 0; i < allCode.size(); ++i) {
-            getAsm(allCode[i]);
+    void store(IROperand o, const string& reg) {
+        if (o.kind() != IRO_TEMP && o.kind() != IRO_SYM && o.kind() != IRO_REF) {
+            fail("assignment to a constant in " + fn->name);
+            return;
         }
+        string target = memory(o);
+        code("mov " + target + ", " + reg);
+    }
 
-        // Generate complete assembly program
-        getAll();
+    // Second operand of an ALU instruction: a 32-bit immediate or rcx
+    string aluOperand(IROperand o) {
+        long long value;
+        if (constantValue(o, value) && fitsInt32(value)) return num(value);
+        load("rcx", o);
+        return "rcx";
     }
 
-    // Get generated assembly code
-    vector<string> getGeneratedCode() const {
-        return allAsmCode;
+    // ---------------- Functions ----------------
+    static const char* condition(IROpcode op) {
+        switch (op) {
+        case IR_GT: return "g";
+        case IR_LT: return "l";
+        case IR_GE: return "ge";
+        case IR_LE: return "le";
+        case IR_EQ: return "e";
+        default: return "ne";
+        }
     }
 
-    // Print generated assembly code
-    void printAsmCode() const {
-        cout << "\n=== Generated 8086 Assembly Code ===" << endl;
-        for (size_t i = 0; i < allAsmCode.size(); ++i) {
-            cout << allAsmCode[i] << endl;
+    static const char* inverse(IROpcode op) {
+        switch (op) {
+        case IR_GT: return "le";
+        case IR_LT: return "ge";
+        case IR_GE: return "l";
+        case IR_LE: return "g";
+        case IR_EQ: return "ne";
+        default: return "e";
         }
     }
 
-    // Write assembly code to file
-    void writeToFile(const string& filename) const {
-        ofstream outFile(filename.c_str());
-        if (outFile.is_open()) {
-            for (size_t i = 0; i < allAsmCode.size(); ++i) {
-                outFile << allAsmCode[i] << endl;
+    void genFunction(const IRFunction& f) {
+        fn = &f;
+        body.clear();
+        pendingArgs.clear();
+        Function* table = findTable(f.name);
+        layoutFrame(table);
+        int paramSlots = static_cast<int>(min<size_t>(6, paramCounts[f.name]));
+        int variableBytes = frameBytes;
+
+        vector<int> jump = IRInterpreter::jumpTargets(f.code);
+        int n = static_cast<int>(f.code.size());
+        vector<bool> isTarget(n + 1, false);
+        for (int i = 0; i < n; ++i) {
+            if (jump[i] >= 0) isTarget[jump[i]] = true;
+        }
+
+        string retLabel = ".L" + num(fnIndex) + "_ret";
+        for (int i = 0; i < n && error.empty(); ++i) {
+            if (isTarget[i]) body.push_back(label(i) + ":");
+            const IRInst& inst = f.code[i];
+            IROpcode op = inst.opcode();
+            switch (op) {
+            case IR_ASSIGN:
+                load("rax", inst.a);
+                store(inst.r, "rax");
+                break;
+            case IR_ADD: case IR_SUB: case IR_MUL: {
+                load("rax", inst.a);
+                string rhs = aluOperand(inst.b);
+                code(string(op == IR_ADD ? "add" : op == IR_SUB ? "sub" : "imul") + " rax, " + rhs);
+                store(inst.r, "rax");
+                break;
+            }
+            case IR_DIV:
+                load("rax", inst.a);
+                load("rcx", inst.b);
+                code("test rcx, rcx");
+                code("jz __c5_div_zero");
+                code("cqo");
+                code("idiv rcx");
+                store(inst.r, "rax");
+                break;
+            case IR_GT: case IR_LT: case IR_GE: case IR_LE: case IR_EQ: case IR_NE: {
+                load("rax", inst.a);
+                string rhs = aluOperand(inst.b);
+                code("cmp rax, " + rhs);
+                code(string("set") + condition(op) + " al");
+                code("movzx eax, al");
+                store(inst.r, "rax");
+                break;
+            }
+            case IR_IF: case IR_ELIF: case IR_DO:
+                if (jump[i] >= 0) {
+                    load("rax", inst.a);
+                    code("test rax, rax");
+                    code("jz " + label(jump[i]));
+                }
+                break;
+            case IR_BR: {
+                // Fused compare-and-branch: one cmp (or test against 0) and one jcc
+                IROpcode cmp = static_cast<IROpcode>(inst.aux);
+                load("rax", inst.a);
+                if (cmp == IR_NE && inst.b == IROperand::imm(0)) {
+                    code("test rax, rax");
+                    code("jz " + label(inst.r.index()));
+                    break;
+                }
+                string rhs = aluOperand(inst.b);
+                code("cmp rax, " + rhs);
+                code(string("j") + inverse(cmp) + " " + label(inst.r.index()));
+                break;
+            }
+            case IR_EL: case IR_WE: case IR_BREAK: case IR_CONTINUE:
+                if (jump[i] >= 0) code("jmp " + label(jump[i]));
+                break;
+            case IR_RETURN:
+                if (inst.a.isNone()) code("xor eax, eax");
+                else load("rax", inst.a);
+                code("jmp " + retLabel);
+                break;
+            case IR_PUSH:
+                pendingArgs.push_back(inst.a);
+                break;
+            case IR_CALL: case IR_CALLR:
+                genCall(fn->names[inst.a.index()]);
+                if (op == IR_CALLR) store(inst.r, "rax");
+                break;
+            case IR_RAW:
+                fail("unknown operator: " + f.opcodeText(inst));
+                break;
+            default:    // FUN, wh, ie are only markers
+                break;
             }
-            outFile.close();
-            cout << "[DEBUG] Assembly code written to: " << filename << endl;
+        }
+        if (isTarget[n]) body.push_back(label(n) + ":");
+        if (!error.empty()) return;
+
+        // Prologue: frame, call depth and stack checks, spilled register arguments,
+        // zeroed variables. Like the VM, at most MAX_DEPTH calls may be active below main.
+        int frame = (frameBytes + 15) / 16 * 16;
+        bool checked = f.name != "main";
+        string overflowLabel = ".L" + num(fnIndex) + "_overflow";
+        emit("");
+        if (checked) {
+            string nameLabel = "__c5_name_" + num(fnIndex);
+            emit("    .section .rodata");
+            emit(nameLabel + ": .ascii \"" + f.name + "\\n\"");
+            emit("    .equ " + nameLabel + "_len, . - " + nameLabel);
+            emit("    .text");
+        }
+        emit("    .globl " + f.name);
+        emit("    .type " + f.name + ", @function");
+        emit(f.name + ":");
+        emit("    push rbp");
+        emit("    mov rbp, rsp");
+        if (frame > 0) emit("    sub rsp, " + num(frame));
+        if (checked) {
+            emit("    inc r15");
+            emit("    cmp r15, " + num(BytecodeVM::MAX_DEPTH));
+            emit("    ja " + overflowLabel);
+            emit("    cmp rsp, r14");
+            emit("    jb " + overflowLabel);
+        }
+        for (int k = 0; k < paramSlots; ++k) {
+            emit(string("    mov QWORD PTR [rbp") + disp(-8 * (k + 1)) + "], " + ARG_REGS[k]);
+        }
+        int zeroSlots = (variableBytes - 8 * paramSlots) / 8;
+        if (zeroSlots > 8) {
+            emit("    lea rdi, [rbp" + disp(-variableBytes) + "]");
+            emit("    mov ecx, " + num(zeroSlots));
+            emit("    xor eax, eax");
+            emit("    rep stosq");
         }
         else {
-            cout << "[ERROR] Could not create output file: " << filename << endl;
+            for (int k = 0; k < zeroSlots; ++k) {
+                emit("    mov QWORD PTR [rbp" + disp(-variableBytes + 8 * k) + "], 0");
+            }
+        }
+        for (size_t k = 0; k < body.size(); ++k) {
+            emit(body[k]);
+        }
+        emit("    xor eax, eax");
+        emit(retLabel + ":");
+        if (checked) emit("    dec r15");
+        emit("    leave");
+        emit("    ret");
+        if (checked) {
+            emit(overflowLabel + ":");
+            emit("    lea rsi, [rip+__c5_name_" + num(fnIndex) + "]");
+            emit("    mov edx, __c5_name_" + num(fnIndex) + "_len");
+            emit("    jmp __c5_overflow");
+        }
+        emit("    .size " + f.name + ", .-" + f.name);
+    }
+
+    // Arguments beyond the sixth go on the stack (pushed right to left, keeping
+    // rsp 16-byte aligned); aggregates are passed by address
+    void genCall(const string& name) {
+        map<string, int>::const_iterator callee = paramCounts.find(name);
+        if (callee == paramCounts.end()) {
+            fail("call to undefined function " + name);
+            return;
+        }
+        if (callee->second != static_cast<int>(pendingArgs.size())) {
+            fail("wrong number of arguments for " + name);
+            return;
+        }
+        int count = static_cast<int>(pendingArgs.size());
+        int stackArgs = max(0, count - 6);
+        int pad = stackArgs % 2;
+        if (pad) code("sub rsp, 8");
+        for (int k = count - 1; k >= 6; --k) {
+            loadArgument("rax", pendingArgs[k]);
+            code("push rax");
+        }
+        for (int k = 0; k < count && k < 6; ++k) {
+            loadArgument(ARG_REGS[k], pendingArgs[k]);
+        }
+        code("call " + name);
+        if (stackArgs + pad > 0) code("add rsp, " + num(8 * (stackArgs + pad)));
+        pendingArgs.clear();
+    }
+
+    void loadArgument(const string& reg, IROperand o) {
+        if (o.kind() == IRO_REF) {
+            // Loading an element may use rcx/rdx, which can already hold arguments
+            fail("array elements and struct members cannot be passed directly");
+            return;
+        }
+        if (o.kind() == IRO_SYM) {
+            StorageMap::const_iterator it = locals.find(fn->names[o.index()]);
+            const Storage* s = it != locals.end() ? &it->second : NULL;
+            if (!s) {
+                it = globals.find(fn->names[o.index()]);
+                if (it != globals.end()) s = &it->second;
+            }
+            if (s && s->aggregate()) {
+                if (s->pointer) code("mov " + reg + ", QWORD PTR [rbp" + disp(s->offset) + "]");
+                else if (!s->symbol.empty()) code("lea " + reg + ", [rip+" + s->symbol + "]");
+                else code("lea " + reg + ", [rbp" + disp(s->offset) + "]");
+                return;
+            }
         }
+        load(reg, o);
     }
 };
 
-int main() {
-    cout << "=== C++ Compiler Frontend with Quaternion Generation, DAG Optimization and Target Code Generation ===" << endl;
+const char* const X64AsmGen::ARG_REGS[6] = { "rdi", "rsi", "rdx", "rcx", "r8", "r9" };
+
+int main(int argc, char* argv[]) {
+    cout << "=== C++ Compiler Frontend with Quaternion Generation, Optimization and Target Code Generation ===" << endl;
+
+    // ѡ--emit-symbols <ļ> дԪļ--import-symbols <ļ> Ԫļ
+    // --dump-symbols ɺӡű--threads <N> N̲߳дĬϴУ
+    // --dump-cfg ӡŻĿͼ--dump-ssa ӡŻSSAʽ
+    // --ir-cache <ļ> ŻIRԴδĺֱ룻
+    // --interpret IRֱŻǰĳ򲢱ȽϽ
+    // --run-vm ŻIRΪֽУIRȽϽʱ
+    // --dump-bytecode ӡֽ룻--jit ֽΪ x86-64 ֱУ
+    // --emit-x64 <ļ>  x86-64 GNU as ࣨΪ Linux ELF
+    // --no-inline رպڱȽǰЧ
+    string emitSymbolsPath;
+    vector<string> importSymbolPaths;
+    bool dumpSymbols = false;
+    int threads = 1;
+    bool dumpCfg = false;
+    bool dumpSsa = false;
+    string irCachePath;
+    bool interpret = false;
+    bool runVm = false;
+    bool dumpBytecode = false;
+    bool jit = false;
+    string x64Path;
+    bool inlineFunctions = true;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "--dump-symbols") {
+            dumpSymbols = true;
+        }
+        else if (arg == "--dump-cfg") {
+            dumpCfg = true;
+        }
+        else if (arg == "--dump-ssa") {
+            dumpSsa = true;
+        }
+        else if (arg == "--threads" && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+            if (threads < 1) {
+                threads = 1;
+            }
+        }
+        else if (arg == "--interpret") {
+            interpret = true;
+        }
+        else if (arg == "--run-vm") {
+            runVm = true;
+        }
+        else if (arg == "--dump-bytecode") {
+            dumpBytecode = true;
+        }
+        else if (arg == "--jit") {
+            jit = true;
+        }
+        else if (arg == "--no-inline") {
+            inlineFunctions = false;
+        }
+        else if (arg == "--emit-x64" && i + 1 < argc) {
+            x64Path = argv[++i];
+        }
+        else if (arg == "--ir-cache" && i + 1 < argc) {
+            irCachePath = argv[++i];
+        }
+        else if (arg == "--emit-symbols" && i + 1 < argc) {
+            emitSymbolsPath = argv[++i];
+        }
+        else if (arg == "--import-symbols" && i + 1 < argc) {
+            importSymbolPaths.push_back(argv[++i]);
+        }
+        else {
+            cerr << "[WARNING] Unknown option: " << arg << endl;
+        }
+    }
 
     // ȡļ
     string filename = "C://Users//Desktop/c_input.txt";
@@ -4293,6 +11246,15 @@ int main() {
         // 
         ll1.getInput(INPUT);
 
+        // 뵥Ԫķļ
+        for (size_t i = 0; i < importSymbolPaths.size(); ++i) {
+            Message importResult = ll1.getSymbolTable()->importSymbolFile(importSymbolPaths[i]);
+            if (importResult.hasError()) {
+                cout << "Error Message: " << importResult.ErrorMessage << endl;
+                return 1;
+            }
+        }
+
         // ﷨
         cout << "\n[DEBUG] Starting syntax and semantic analysis..." << endl;
         Message result = ll1.analyzeInputString();
@@ -4308,9 +11270,22 @@ int main() {
             cout << "Analysis completed successfully!" << endl;
         }
 
+        // űArenaͳ
+        cout << "\n=== Symbol Table Arena ===" << endl;
+        cout << "Allocations: " << ll1.getSymbolTable()->arena.allocationCount()
+            << ", chunks: " << ll1.getSymbolTable()->arena.chunkCount()
+            << ", bytes: " << ll1.getSymbolTable()->arena.usedBytes() << endl;
+
+        // д뵥Ԫķļ
+        if (!emitSymbolsPath.empty() && !ll1.getSymbolTable()->saveSymbolFile(emitSymbolsPath)) {
+            return 1;
+        }
+
         // ӡű
-        cout << "\n=== Symbol Table ===" << endl;
-        ll1.printSymbolTable();
+        if (dumpSymbols) {
+            cout << "\n=== Symbol Table ===" << endl;
+            ll1.printSymbolTable();
+        }
 
         // Ԫʽ
         cout << "\n[DEBUG] Starting quaternion generation..." << endl;
@@ -4322,46 +11297,185 @@ int main() {
         // ȡб
         vector<vector<Token> > funcBlocks = ll1.getFuncBlocks();
 
-        // ΪÿԪʽ
+        // ˺űֻԲд˳طţ봮нһ
+        ThreadPool* pool = threads > 1 ? new ThreadPool(threads) : NULL;
+
+        // IR棺ԴtokenɢвңеĺŻ
+        vector<uint64_t> sourceHashes;
+        vector<IRFunction*> cachedIR(funcBlocks.size(), static_cast<IRFunction*>(NULL));
+        vector<int> originalCounts(funcBlocks.size(), 0);    // Żǰָ
+        map<string, int> cachedCallSites;
+        if (!irCachePath.empty()) {
+            // Żˮߵİ汾ṹĲ֣Աַ͡鳤ȣͺ
+            // ӰһɢУṹںtoken֮
+            stringstream pipeline;
+            pipeline << "pipeline" << Optimization::PIPELINE_VERSION << ";";
+            SYMBOL* sym = ll1.getSymbolTable();
+            for (size_t i = 0; i < sym->structNameList.size(); ++i) {
+                pipeline << sym->structNameList[i] << ";";
+            }
+            for (size_t i = 0; i < sym->structList.size(); ++i) {
+                const Struct* st = sym->structList[i];
+                pipeline << "struct " << st->structName << "{";
+                for (VariableDict::const_iterator it = st->variableDict.begin(); it != st->variableDict.end(); ++it) {
+                    const Variable& v = it->second;
+                    pipeline << it->first << ":" << v.fullType << "@" << v.addr;
+                    if (v.isArray) pipeline << "[" << v.arraySize << "]";
+                    pipeline << ";";
+                }
+                pipeline << "}";
+            }
+            string context = pipeline.str();
+            for (size_t i = 0; i < sym->functionNameList.size(); ++i) {
+                context += sym->functionNameList[i] + ";";
+            }
+            if (inlineFunctions) {
+                context += "inline;";
+            }
+
+            IRFile cache;
+            bool haveCache = cache.open(irCachePath);
+            set<string> functionNames(sym->functionNameList.begin(), sym->functionNameList.end());
+            for (size_t i = 0; i < funcBlocks.size(); ++i) {
+                sourceHashes.push_back(IRFile::hashTokens(funcBlocks[i], context));
+            }
+            if (inlineFunctions) {
+                IRFile::mixCallees(sourceHashes, funcBlocks, functionNames);
+            }
+            for (size_t i = 0; i < funcBlocks.size(); ++i) {
+                int f = haveCache ? cache.findFunction(sourceHashes[i]) : -1;
+                if (f >= 0) {
+                    cachedIR[i] = cache.load(f);
+                    originalCounts[i] = cache.originalCount(f);
+                }
+            }
+
+            // ҪñδŻIR·ĺֱӻӣõĺ
+            // ʹлҲ·룻Իĺеĵõ
+            if (inlineFunctions) {
+                vector<string> owners;
+                vector<vector<string> > calls;
+                IRFile::scanCalls(funcBlocks, functionNames, owners, calls);
+                vector<set<int> > reached = IRFile::reachableCallees(owners, calls);
+                for (size_t i = 0; i < funcBlocks.size(); ++i) {
+                    if (cachedIR[i]) continue;
+                    for (set<int>::const_iterator it = reached[i].begin(); it != reached[i].end(); ++it) {
+                        delete cachedIR[*it];
+                        cachedIR[*it] = NULL;
+                    }
+                }
+                for (size_t i = 0; i < funcBlocks.size(); ++i) {
+                    if (!cachedIR[i]) continue;
+                    for (size_t k = 0; k < calls[i].size(); ++k) cachedCallSites[calls[i][k]]++;
+                }
+            }
+        }
+
+        // Ҫ·ĺ鼰±
+        vector<vector<Token> > pendingBlocks;
+        vector<size_t> pendingIndex;
         for (size_t i = 0; i < funcBlocks.size(); ++i) {
-            cout << "\n[DEBUG] Generating quaternions for function " << i << endl;
-            qtGen.genQt(funcBlocks[i]);
+            if (cachedIR[i]) {
+                cout << "\n[DEBUG] Function " << i << " loaded from IR cache" << endl;
+            }
+            else {
+                pendingIndex.push_back(i);
+            }
+        }
+        if (pendingIndex.size() < funcBlocks.size()) {
+            for (size_t k = 0; k < pendingIndex.size(); ++k) {
+                pendingBlocks.push_back(funcBlocks[pendingIndex[k]]);
+            }
+        }
+        const vector<vector<Token> >& toTranslate =
+            pendingIndex.size() < funcBlocks.size() ? pendingBlocks : funcBlocks;
+
+        // ΪÿԪʽ
+        if (pool) {
+            vector<string> logs = qtGen.genQtParallel(toTranslate, *pool);
+            for (size_t k = 0; k < logs.size(); ++k) {
+                cout << "\n[DEBUG] Generating quaternions for function " << pendingIndex[k] << endl;
+                cout << logs[k];
+            }
+        }
+        else {
+            for (size_t k = 0; k < toTranslate.size(); ++k) {
+                cout << "\n[DEBUG] Generating quaternions for function " << pendingIndex[k] << endl;
+                qtGen.genQt(toTranslate[k]);
+            }
         }
 
         // ӡŻǰԪʽ
         cout << "\n=== Quaternions (Before Optimization) ===" << endl;
         qtGen.printQuaternions();
 
-        // DAGŻ
-        cout << "\n[DEBUG] Starting DAG optimization..." << endl;
+        // Ż
+        cout << "\n[DEBUG] Starting optimization..." << endl;
 
         // Ż
         Optimization optimizer(ll1.getSymbolTable());
-        cout << "\n=== Symbol Table ===" << endl;
-        // ӡű
-        cout << "\n=== Symbol Table ===" << endl;
-        ll1.printSymbolTable();
-        // ȡԭʼԪʽ
-        vector<vector<Quaternion> > originalQt = qtGen.getQtRes();
+        // ȡ߸IRָֻ֮봫ݣɺһͷţ
+        vector<IRFunction*> translated = qtGen.takeIR();
+        for (size_t k = 0; k < translated.size(); ++k) {
+            originalCounts[pendingIndex[k]] = static_cast<int>(translated[k]->code.size());
+        }
+
+        // ŻǾ͵ؽеģδŻҪУкԻʱûδŻİ汾
+        IRInterpreter* unoptimizedRun = NULL;
+        if (interpret && translated.size() == funcBlocks.size()) {
+            unoptimizedRun = new IRInterpreter(ll1.getSymbolTable(), translated);
+            unoptimizedRun->run();
+        }
+
+        // ڸŻ֮ǰнУֻڱηĺ֮ҪδŻIR
+        // ·ĺıһ룩ӻĺǰıǵű
+        Inliner inliner(ll1.getSymbolTable());
+        if (inlineFunctions) {
+            inliner.run(translated, cachedCallSites);
+            cout << "\n[DEBUG] Inlined " << inliner.inlinedCalls << " call site(s)" << endl;
+        }
+        for (size_t i = 0; i < cachedIR.size(); ++i) {
+            if (cachedIR[i]) inliner.declareVariables(*cachedIR[i]);
+        }
+
+        // ÿԪʽŻ͵ؽУ
+        if (pool) {
+            // ÿʹԼŻ
+            vector<string> logs = pool->run(translated.size(), [&](size_t k) {
+                Optimization local(optimizer);
+                local.opt(translated[k]);
+            });
+            for (size_t k = 0; k < logs.size(); ++k) {
+                cout << "\n[DEBUG] Optimizing quaternions for function " << pendingIndex[k] << endl;
+                cout << logs[k];
+            }
+        }
+        else {
+            for (size_t k = 0; k < translated.size(); ++k) {
+                cout << "\n[DEBUG] Optimizing quaternions for function " << pendingIndex[k] << endl;
+                optimizer.opt(translated[k]);
+            }
+        }
 
-        // ÿԪʽŻ
-        vector<vector<vector<Quaternion> > > optimizedQt;
-        for (size_t i = 0; i < originalQt.size(); ++i) {
-            cout << "\n[DEBUG] Optimizing quaternions for function " << i << endl;
-            // ŻǰԪʽ
-            vector<vector<Quaternion> > optimizedBlocks = optimizer.opt(originalQt[i]);
-            optimizedQt.push_back(optimizedBlocks);
+        // ˳ϲ·ĺʹӻIR
+        vector<IRFunction*> functionIR(cachedIR);
+        for (size_t k = 0; k < translated.size(); ++k) {
+            functionIR[pendingIndex[k]] = translated[k];
+        }
+        if (!irCachePath.empty() && !translated.empty()) {
+            IRFile::write(irCachePath, functionIR, sourceHashes, originalCounts);
         }
 
         // ӡŻԪʽ
-        cout << "\n=== Quaternions (After DAG Optimization) ===" << endl;
-        for (size_t i = 0; i < optimizedQt.size(); ++i) {
+        cout << "\n=== Quaternions (After Optimization) ===" << endl;
+        for (size_t i = 0; i < functionIR.size(); ++i) {
             cout << "Function " << i << ":" << endl;
             int qtIndex = 0;
-            for (size_t j = 0; j < optimizedQt[i].size(); ++j) {
+            vector<vector<Quaternion> > blocks = IRAdapter::toBlocks(*functionIR[i]);
+            for (size_t j = 0; j < blocks.size(); ++j) {
                 cout << "  Basic Block " << j << ":" << endl;
-                for (size_t k = 0; k < optimizedQt[i][j].size(); ++k) {
-                    const Quaternion& q = optimizedQt[i][j][k];
+                for (size_t k = 0; k < blocks[j].size(); ++k) {
+                    const Quaternion& q = blocks[j][k];
                     cout << "    [" << qtIndex++ << "] (" << q.op << ", "
                         << q.arg1 << ", " << q.arg2 << ", "
                         << q.result << ")" << endl;
@@ -4369,19 +11483,31 @@ int main() {
             }
         }
 
+        if (dumpCfg) {
+            cout << "\n=== Control Flow Graphs ===" << endl;
+            for (size_t i = 0; i < functionIR.size(); ++i) {
+                cout << "Function " << i << " (" << functionIR[i]->name << "):" << endl;
+                ControlFlowGraph(*functionIR[i]).print(cout);
+            }
+        }
+        if (dumpSsa) {
+            cout << "\n=== SSA Form ===" << endl;
+            for (size_t i = 0; i < functionIR.size(); ++i) {
+                cout << "Function " << i << " (" << functionIR[i]->name << "):" << endl;
+                SSAForm(*functionIR[i], optimizer.ssaVariables(*functionIR[i])).print(*functionIR[i], cout);
+            }
+        }
+
         // ͳŻЧ
         cout << "\n=== Optimization Statistics ===" << endl;
         int originalCount = 0;
         int optimizedCount = 0;
+        size_t irBytes = 0;
 
-        for (size_t i = 0; i < originalQt.size(); ++i) {
-            originalCount += originalQt[i].size();
-        }
-
-        for (size_t i = 0; i < optimizedQt.size(); ++i) {
-            for (size_t j = 0; j < optimizedQt[i].size(); ++j) {
-                optimizedCount += optimizedQt[i][j].size();
-            }
+        for (size_t i = 0; i < functionIR.size(); ++i) {
+            originalCount += originalCounts[i];
+            optimizedCount += functionIR[i]->code.size();
+            irBytes += functionIR[i]->byteSize();
         }
 
         cout << "Original quaternion count: " << originalCount << endl;
@@ -4389,10 +11515,126 @@ int main() {
         cout << "Reduction: " << (originalCount - optimizedCount)
             << " (" << (100.0 * (originalCount - optimizedCount) / originalCount)
             << "%)" << endl;
+        cout << "Compact IR: " << irBytes << " bytes (" << sizeof(IRInst) << " bytes/instruction)" << endl;
+        if (interpret) {
+            cout << "\n=== IR Interpreter ===" << endl;
+            IRInterpreter optimizedRun(ll1.getSymbolTable(), functionIR);
+            optimizedRun.run();
+            if (unoptimizedRun) {
+                cout << "Unoptimized: ";
+                if (unoptimizedRun->error.empty()) cout << "main returned " << unoptimizedRun->result << endl;
+                else cout << "runtime error: " << unoptimizedRun->error << endl;
+                unoptimizedRun->printStats(cout);
+            }
+            cout << "Optimized: ";
+            if (optimizedRun.error.empty()) cout << "main returned " << optimizedRun.result << endl;
+            else cout << "runtime error: " << optimizedRun.error << endl;
+            optimizedRun.printStats(cout);
+
+            if (unoptimizedRun) {
+                // ȽϷֵ main бֵ
+                string diff = IRInterpreter::firstDifference(*unoptimizedRun, optimizedRun);
+                if (diff.empty()) {
+                    cout << "Optimized program matches unoptimized program ("
+                        << unoptimizedRun->executed << " -> " << optimizedRun.executed
+                        << " instructions)" << endl;
+                }
+                else {
+                    cout << "[WARNING] Optimized program differs from unoptimized program: " << diff << endl;
+                }
+                delete unoptimizedRun;
+            }
+        }
+
+        if (runVm || dumpBytecode) {
+            cout << "\n=== Bytecode VM ===" << endl;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            BytecodeVM vm(ll1.getSymbolTable(), functionIR);
+            double lowerMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            if (!vm.compileError.empty()) {
+                cout << "[WARNING] Program cannot run in the bytecode VM: " << vm.compileError << endl;
+            }
+            else {
+                cout << "Lowered " << vm.functionCount() << " functions to " << vm.instructionCount()
+                    << " instructions (" << vm.byteSize() << " bytes) in " << lowerMs << " ms" << endl;
+                if (dumpBytecode) {
+                    vm.print(cout);
+                }
+            }
+            if (runVm && vm.compileError.empty()) {
+                start = chrono::steady_clock::now();
+                vm.run();
+                double vmMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                if (vm.error.empty()) cout << "main returned " << vm.result << endl;
+                else cout << "runtime error: " << vm.error << endl;
+
+                // ͬһIRڽеĽʱ
+                start = chrono::steady_clock::now();
+                IRInterpreter reference(ll1.getSymbolTable(), functionIR);
+                reference.run();
+                double irMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                cout << "VM time: " << vmMs << " ms, IR interpreter time: " << irMs << " ms";
+                if (vmMs > 0) cout << " (" << irMs / vmMs << "x)";
+                cout << endl;
+                if (vm.error != reference.error || (vm.error.empty() && IRValue::ofInt(vm.result) != reference.result)) {
+                    cout << "[WARNING] Bytecode VM differs from IR interpreter: ";
+                    if (vm.error != reference.error) cout << "error '" << vm.error << "' vs '" << reference.error << "'" << endl;
+                    else cout << "main returned " << vm.result << " vs " << reference.result << endl;
+                }
+                else {
+                    cout << "Bytecode VM matches IR interpreter" << endl;
+                }
+            }
+        }
+
+        if (jit) {
+            cout << "\n=== x86-64 JIT ===" << endl;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            BytecodeVM vm(ll1.getSymbolTable(), functionIR);
+            X86Jit native(vm);
+            double compileMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            if (!native.error.empty()) {
+                cout << "[WARNING] Program cannot be JIT-compiled: " << native.error << endl;
+            }
+            else {
+                cout << "Compiled " << native.stats.size() << " functions to " << native.codeSize()
+                    << " bytes of machine code in " << compileMs << " ms (including bytecode lowering)" << endl;
+                for (size_t k = 0; k < native.stats.size(); ++k) {
+                    const X86Jit::FunctionStats& s = native.stats[k];
+                    cout << "  " << s.name << ": " << s.bytecode << " bytecode instructions -> " << s.bytes
+                        << " bytes, " << s.registers << " registers, " << s.ms << " ms" << endl;
+                }
+
+                start = chrono::steady_clock::now();
+                native.run();
+                double jitMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                if (native.error.empty()) cout << "main returned " << native.result << endl;
+                else cout << "runtime error: " << native.error << endl;
+
+                start = chrono::steady_clock::now();
+                IRInterpreter reference(ll1.getSymbolTable(), functionIR);
+                reference.run();
+                double irMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+                cout << "JIT time: " << jitMs << " ms, IR interpreter time: " << irMs << " ms";
+                if (jitMs > 0) cout << " (" << irMs / jitMs << "x)";
+                cout << endl;
+                if (native.error != reference.error ||
+                    (native.error.empty() && IRValue::ofInt(native.result) != reference.result)) {
+                    cout << "[WARNING] JIT differs from IR interpreter: ";
+                    if (native.error != reference.error) cout << "error '" << native.error << "' vs '" << reference.error << "'" << endl;
+                    else cout << "main returned " << native.result << " vs " << reference.result << endl;
+                }
+                else {
+                    cout << "JIT matches IR interpreter" << endl;
+                }
+            }
+        }
+
         cout << "\n[DEBUG] Starting target code generation..." << endl;
 
         // Ŀ
-        AsmCodeGen asmGen(ll1.getSymbolTable(), optimizedQt);
+        AsmCodeGen asmGen(ll1.getSymbolTable(), functionIR, pool);
+        delete pool;
 
         // ӡɵĻ
         asmGen.printAsmCode();
@@ -4400,6 +11642,14 @@ int main() {
         // дļ
         string asmFilename = "C://Users//Desktop/output.asm";
         asmGen.writeToFile(asmFilename);
+
+        if (!x64Path.empty()) {
+            X64AsmGen x64Gen(ll1.getSymbolTable(), functionIR);
+            x64Gen.writeToFile(x64Path);
+        }
+
+        // ɣͷȫIR
+        IRAdapter::release(functionIR);
         return 0;
  }
  
\ No newline at end of file